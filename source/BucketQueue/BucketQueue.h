@@ -0,0 +1,372 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../util/Bits.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+template<class V, class K> class BucketQueue;
+
+/**
+ * @brief Template for nodes of a bucket queue.
+ *
+ * Bucket queue nodes are linked into the doubly linked list of the bucket
+ * of their key. They are associated with a key of type `K` and store some
+ * value of type `V`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct BNode : public INode<V, K>
+{
+public:
+    friend class BucketQueue<V, K>;
+
+    /**
+     * @brief Gets the value of the heap node.
+     *
+     * @return The value stored in the heap node
+     */
+    V getValue()
+    {
+        return value;
+    }
+
+    /**
+     * @brief Gets the key associated with the heap node.
+     *
+     * @return The key associated with the heap node
+     */
+    K getKey()
+    {
+        return key;
+    }
+
+private:
+    BNode* prev;
+    BNode* next;
+
+    V value;
+    K key;
+};
+
+/**
+ * @brief Template for bucket queues (Dial's algorithm).
+ *
+ * Bucket queues are priority queues for integer keys from a small range: all
+ * keys in the queue must differ by at most the range \f$ C \f$ of the queue.
+ * This holds for monotone use, where no key is smaller than the key most
+ * recently deleted, if \f$ C \f$ bounds the increase of keys, e.g. for
+ * Dijkstra's algorithm with edge weights of at most \f$ C \f$.
+ *
+ * The queue keeps a circular array of \f$ 2^k > C \f$ buckets, where key
+ * \f$ x \f$ belongs to bucket \f$ x \bmod 2^k \f$, and a window of keys
+ * starting at a lower bound of the smallest key. Deleting the minimum
+ * advances the window to the next non-empty bucket, skipping 64 empty
+ * buckets at once. Hence, every operation takes constant time, except for
+ * deletions which take \f$ O(1 + d / 64) \f$ time for a distance of
+ * \f$ d \le C \f$ keys to the next minimum.
+ *
+ * Keys are bounded from above by the largest key inserted since the queue
+ * was last empty. If a key is too far from this bound or from the window,
+ * both are first narrowed to the smallest and largest key in the queue. If
+ * the key is still too far, the bucket array either grows to the next power
+ * of two covering all keys, in time linear in the number of nodes and
+ * buckets, or the operation fails with `std::out_of_range`. The bucket array
+ * never grows beyond `MAX_BUCKETS` buckets, keys spread further apart fail in
+ * either mode.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for integral key types of at most 64 bits
+ */
+template<class V, class K>
+class BucketQueue
+: public HeapBase<BucketQueue<V, K>, V, K, BNode<V, K>*>
+{
+    static_assert(std::is_integral<K>::value,
+        "BucketQueue requires integral keys");
+    static_assert(sizeof(K) <= sizeof(std::uint64_t),
+        "BucketQueue requires keys of at most 64 bits");
+
+private:
+    std::vector<BNode<V, K>*> buckets;
+    std::vector<std::uint64_t> occupied;
+    std::uint64_t mask;
+
+    bool grow;
+
+    K last;
+    K high;
+    int count;
+
+    std::shared_ptr<NodePool<BNode<V, K>>> pool;
+
+public:
+    /**
+     * @brief Largest number of buckets, i.e. 512 MiB of bucket pointers.
+     */
+    static const std::uint64_t MAX_BUCKETS = std::uint64_t(1) << 26;
+
+    /**
+     * @brief Constructs a new bucket queue with its own node pool.
+     *
+     * @param range Largest difference between any two keys in the queue
+     * @param grow Whether to grow the bucket array for keys beyond the range
+     * instead of throwing `std::out_of_range`
+     * @throws std::out_of_range if `range` requires more than `MAX_BUCKETS`
+     * buckets
+     */
+    explicit BucketQueue(std::uint64_t range = 1024, bool grow = true)
+    : grow(grow), pool(std::make_shared<NodePool<BNode<V, K>>>())
+    {
+        _allocate(range);
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new bucket queue allocating from a given pool.
+     *
+     * @param pool The node pool to allocate nodes from
+     * @param range Largest difference between any two keys in the queue
+     * @param grow Whether to grow the bucket array for keys beyond the range
+     * instead of throwing `std::out_of_range`
+     * @throws std::out_of_range if `range` requires more than `MAX_BUCKETS`
+     * buckets
+     */
+    BucketQueue(std::shared_ptr<NodePool<BNode<V, K>>> pool,
+        std::uint64_t range, bool grow = true)
+    : grow(grow), pool(pool)
+    {
+        assert(pool);
+
+        _allocate(range);
+        _init();
+    }
+
+    BucketQueue(const BucketQueue&) = delete;
+    BucketQueue& operator=(const BucketQueue&) = delete;
+
+    /**
+     * @brief Destroys the bucket queue and all of its nodes.
+     *
+     */
+    ~BucketQueue()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the bucket queue.
+     *
+     * Afterwards, any key may be inserted again.
+     *
+     * Runtime: \f$ O(b) \f$ or \f$ O(n + b) \f$ for \f$ b \f$ buckets, as
+     * for the other heaps
+     */
+    void clear();
+
+    /**
+     * @brief Determines the current size of the bucket queue.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Determines the largest supported difference between keys.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The number of buckets minus one
+     */
+    std::uint64_t getRange()
+    {
+        return mask;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the bucket queue.
+     *
+     * Runtime: \f$ O(1) \f$, \f$ O(n + b) \f$ if the bucket array grows
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return A pointer to the resulting heap node
+     * @throws std::out_of_range if `key` exceeds the range and the bucket
+     * array does not grow or would exceed `MAX_BUCKETS` buckets
+     */
+    BNode<V, K>* insert(V element, K key)
+    {
+        if (count == 0)
+        {
+            last = key;
+            high = key;
+        }
+
+        _fit(key, key);
+
+        BNode<V, K>* node = new (pool->allocate()) BNode<V, K>;
+        node->value = element;
+        node->key = key;
+
+        _push(node);
+        ++count;
+
+        return node;
+    }
+
+    /**
+     * @brief Determines the value of the node with the smallest key.
+     *
+     * Runtime: \f$ O(1 + C / 64) \f$
+     *
+     * @return Value of the smallest element
+     */
+    V min()
+    {
+        assert(count > 0);
+
+        _advance();
+
+        return buckets[_index(last)]->value;
+    }
+
+    /**
+     * @brief Determines the smallest key.
+     *
+     * Runtime: \f$ O(1 + C / 64) \f$
+     *
+     * @return The smallest key
+     */
+    K minKey()
+    {
+        assert(count > 0);
+
+        _advance();
+
+        return last;
+    }
+
+    /**
+     * @brief Deletes the heap node with smallest key and returns its value.
+     *
+     * Runtime: \f$ O(1 + C / 64) \f$
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(count > 0);
+
+        _advance();
+
+        return remove(buckets[_index(last)]);
+    }
+
+    /**
+     * @brief Removes a given node from the bucket queue.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param handle Pointer to the node to remove
+     * @return Value of the deleted node
+     */
+    V remove(BNode<V, K>* handle)
+    {
+        V value = handle->value;
+
+        _unlink(handle);
+        _free(handle);
+        --count;
+
+        return value;
+    }
+
+    /**
+     * @brief Decreases the key of a given heap node.
+     *
+     * Runtime: \f$ O(1) \f$, \f$ O(n + b) \f$ if the bucket array grows
+     *
+     * @param handle Pointer to the heap node
+     * @param key New key value of the heap node
+     * @throws std::out_of_range if `key` exceeds the range and the bucket
+     * array does not grow or would exceed `MAX_BUCKETS` buckets
+     */
+    void decreaseKey(BNode<V, K>* handle, K key)
+    {
+        if (key < handle->key)
+        {
+            _fit(key, key);
+
+            _unlink(handle);
+            handle->key = key;
+            _push(handle);
+        }
+    }
+
+    /**
+     * @brief Merges two instances of bucket queues.
+     *
+     * Every node of `heap` is moved into the buckets of this queue, hence the
+     * keys of both queues must lie within the range. Afterwards, `heap` is
+     * left empty.
+     *
+     * Runtime: \f$ O(m + b) \f$ for \f$ m \f$ nodes and \f$ b \f$ buckets in
+     * `heap`
+     *
+     * @param heap Pointer to the bucket queue to merge with
+     * @throws std::out_of_range if a key of `heap` exceeds the range and the
+     * bucket array does not grow or would exceed `MAX_BUCKETS` buckets,
+     * leaving both queues unchanged
+     */
+    void merge(BucketQueue<V, K>* heap);
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     *
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<BNode<V, K>>> getPool()
+    {
+        return pool;
+    }
+
+private:
+    void _allocate(std::uint64_t range);
+
+    void _init();
+
+    void _free(BNode<V, K>* handle);
+
+    std::size_t _index(K key);
+
+    void _fit(K low, K top);
+
+    void _tighten();
+
+    void _resize(std::uint64_t range);
+
+    void _push(BNode<V, K>* handle);
+
+    void _unlink(BNode<V, K>* handle);
+
+    void _advance();
+};
+
+#include "BucketQueue.hpp"
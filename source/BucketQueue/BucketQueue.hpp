@@ -0,0 +1,280 @@
+template<class V, class K>
+void BucketQueue<V, K>::_allocate(std::uint64_t range)
+{
+    if (range >= MAX_BUCKETS)
+    {
+        throw std::out_of_range(
+            "range exceeds the maximum number of buckets");
+    }
+
+    // at least one word of occupancy bits
+    std::uint64_t size = 64;
+    while (size <= range)
+    {
+        size <<= 1;
+    }
+
+    buckets.assign(size, NULL);
+    occupied.assign(size / 64, 0);
+    mask = size - 1;
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_init()
+{
+    std::fill(buckets.begin(), buckets.end(),
+        static_cast<BNode<V, K>*>(NULL));
+    std::fill(occupied.begin(), occupied.end(), 0);
+
+    last = 0;
+    high = 0;
+    count = 0;
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::clear()
+{
+    if (pool.use_count() == 1
+        && std::is_trivially_destructible<BNode<V, K>>::value)
+    {
+        pool->release();
+    }
+    else
+    {
+        for (std::size_t i = 0; i < buckets.size(); ++i)
+        {
+            BNode<V, K>* current = buckets[i];
+            while (current)
+            {
+                BNode<V, K>* node = current;
+                current = current->next;
+                _free(node);
+            }
+        }
+    }
+
+    _init();
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_free(BNode<V, K>* handle)
+{
+    handle->~BNode<V, K>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K>
+std::size_t BucketQueue<V, K>::_index(K key)
+{
+    // unsigned arithmetic wraps keys of any sign around the buckets
+    return static_cast<std::size_t>(static_cast<std::uint64_t>(key) & mask);
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_fit(K low, K top)
+{
+    std::uint64_t distance =
+        static_cast<std::uint64_t>(std::max(top, high))
+        - static_cast<std::uint64_t>(std::min(low, last));
+
+    // removals may leave the window wider than the keys in the queue
+    if (distance > mask && count > 0)
+    {
+        _tighten();
+    }
+
+    low = std::min(low, last);
+    top = std::max(top, high);
+    distance =
+        static_cast<std::uint64_t>(top) - static_cast<std::uint64_t>(low);
+
+    if (distance > mask)
+    {
+        if (!grow || distance >= MAX_BUCKETS)
+        {
+            throw std::out_of_range(
+                "key exceeds the range of the bucket queue");
+        }
+
+        _resize(distance);
+    }
+
+    // buckets do not depend on the window, which may move down freely
+    last = low;
+    high = top;
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_tighten()
+{
+    _advance();
+
+    /*
+     * the window covers all keys, hence the occupied bucket furthest from its
+     * start holds the largest key: search downwards from the bucket before
+     */
+    std::size_t start = _index(last);
+    std::size_t end = (start + mask) & mask;
+
+    std::size_t word = end / 64;
+    std::uint64_t bits =
+        occupied[word] & (~std::uint64_t(0) >> (63 - end % 64));
+    while (!bits)
+    {
+        word = (word + occupied.size() - 1) & (occupied.size() - 1);
+        bits = occupied[word];
+    }
+
+    std::size_t bucket = 64 * word + highestBit(bits);
+    high = static_cast<K>(static_cast<std::uint64_t>(last)
+        + ((bucket - start) & mask));
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_resize(std::uint64_t range)
+{
+    // chain all nodes into one list before reallocating the buckets
+    BNode<V, K>* nodes = NULL;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        BNode<V, K>* current = buckets[i];
+        while (current)
+        {
+            BNode<V, K>* node = current;
+            current = current->next;
+
+            node->next = nodes;
+            nodes = node;
+        }
+    }
+
+    _allocate(range);
+
+    while (nodes)
+    {
+        BNode<V, K>* node = nodes;
+        nodes = nodes->next;
+        _push(node);
+    }
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_push(BNode<V, K>* handle)
+{
+    std::size_t bucket = _index(handle->key);
+
+    handle->prev = NULL;
+    handle->next = buckets[bucket];
+    if (buckets[bucket])
+    {
+        buckets[bucket]->prev = handle;
+    }
+    buckets[bucket] = handle;
+
+    occupied[bucket / 64] |= std::uint64_t(1) << (bucket % 64);
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_unlink(BNode<V, K>* handle)
+{
+    std::size_t bucket = _index(handle->key);
+
+    if (handle->prev)
+    {
+        handle->prev->next = handle->next;
+    }
+    else
+    {
+        buckets[bucket] = handle->next;
+    }
+
+    if (handle->next)
+    {
+        handle->next->prev = handle->prev;
+    }
+
+    if (!buckets[bucket])
+    {
+        occupied[bucket / 64] &= ~(std::uint64_t(1) << (bucket % 64));
+    }
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::_advance()
+{
+    std::size_t start = _index(last);
+    if (buckets[start])
+    {
+        return;
+    }
+
+    // the queue is not empty, hence the search wraps around at most once
+    std::size_t word = start / 64;
+    std::uint64_t bits = occupied[word] & (~std::uint64_t(0) << (start % 64));
+    while (!bits)
+    {
+        word = (word + 1) & (occupied.size() - 1);
+        bits = occupied[word];
+    }
+
+    std::size_t bucket = 64 * word + lowestBit(bits);
+    last = static_cast<K>(static_cast<std::uint64_t>(last)
+        + ((bucket - start) & mask));
+}
+
+template<class V, class K>
+void BucketQueue<V, K>::merge(BucketQueue<V, K>* heap)
+{
+    if (heap == this || heap->count == 0)
+    {
+        return;
+    }
+
+    // check the keys of heap before changing either queue
+    K low = heap->minKey();
+    K top = low;
+    for (std::size_t i = 0; i < heap->buckets.size(); ++i)
+    {
+        for (BNode<V, K>* node = heap->buckets[i]; node; node = node->next)
+        {
+            if (top < node->key)
+            {
+                top = node->key;
+            }
+        }
+    }
+
+    if (count == 0)
+    {
+        last = low;
+        high = low;
+    }
+
+    _fit(low, top);
+
+    if (heap->pool != pool)
+    {
+        if (heap->pool.use_count() == 1)
+        {
+            pool->splice(*heap->pool);
+        }
+        else
+        {
+            pool->retain(heap->pool);
+        }
+    }
+
+    for (std::size_t i = 0; i < heap->buckets.size(); ++i)
+    {
+        BNode<V, K>* current = heap->buckets[i];
+        while (current)
+        {
+            BNode<V, K>* node = current;
+            current = current->next;
+            _push(node);
+        }
+    }
+
+    count += heap->count;
+    heap->_init();
+}
@@ -0,0 +1,422 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../util/Bits.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+template<class V, class K, class Compare> class CompactFibonacciHeap;
+
+/**
+ * @brief Template for nodes of a compact fibonacci heap.
+ *
+ * Compact fibonacci heap nodes live within one contiguous array and refer to
+ * their parent node, left and right sibling as well as one child node by
+ * 32 bit indices into that array. Rank and mark share a single 32 bit word.
+ *
+ * They are associated with a key of type `K` and store some value of type `V`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct CFNode
+{
+public:
+    template<class, class, class> friend class CompactFibonacciHeap;
+
+    /**
+     * @brief Get the index of the parent node.
+     *
+     * @return The index of the parent node
+     */
+    std::uint32_t getParent() const
+    {
+        return parent;
+    }
+
+    /**
+     * @brief Gets the index of the left sibling node.
+     *
+     * @return The index of the left sibling node
+     */
+    std::uint32_t getLeft() const
+    {
+        return left;
+    }
+
+    /**
+     * @brief Gets the index of the right sibling node.
+     *
+     * @return The index of the right sibling node
+     */
+    std::uint32_t getRight() const
+    {
+        return right;
+    }
+
+    /**
+     * @brief Gets the index of one child node.
+     *
+     * @return The index of one child node
+     */
+    std::uint32_t getChild() const
+    {
+        return child;
+    }
+
+    /**
+     * @brief Gets the value of the heap node.
+     *
+     * @return The value stored in the heap node
+     */
+    const V& getValue() const
+    {
+        return value;
+    }
+
+    /**
+     * @brief Gets the key associated with the heap node.
+     *
+     * @return The key associated with the heap node
+     */
+    const K& getKey() const
+    {
+        return key;
+    }
+
+    /**
+     * @brief Get the rank associated with the heap node.
+     *
+     * @return The rank of the heap node.
+     */
+    int getRank() const
+    {
+        return rank;
+    }
+
+    /**
+     * @brief Checks whether the heap node is marked.
+     *
+     * @return true if the node is marked, false otherwise
+     */
+    bool isMarked() const
+    {
+        return marked;
+    }
+
+private:
+    std::uint32_t parent;
+    std::uint32_t left;
+    std::uint32_t right;
+    std::uint32_t child;
+
+    std::uint32_t rank : 31;
+    std::uint32_t marked : 1;
+
+    V value;
+    K key;
+};
+
+/**
+ * @brief Template for compact fibonacci heap data structures.
+ *
+ * Compact fibonacci heaps perform the same operations as `FibonacciHeap`, but
+ * store all nodes within one contiguous array and link them by 32 bit
+ * indices instead of pointers. Handles are indices into that array as well.
+ * This roughly halves the size of a node for small keys and values, and the
+ * array may be relocated or written out as a flat buffer, since it does not
+ * contain any pointer.
+ *
+ * Deleted nodes are kept in a free list threaded through their right index
+ * and reused by subsequent insertions. Values must be default constructible
+ * and movable, and a heap holds less than \f$ 2^{32} - 1 \f$ nodes.
+ *
+ * This results in amortized logarithmic time for deletions and amortized
+ * constant time for every other operation but merging.
+ *
+ * All operations are statically dispatched.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @tparam Compare Template parameter for the strict weak ordering of keys,
+ * the heap maintains the smallest key with respect to it
+ */
+template<class V, class K, class Compare = std::less<K>>
+class CompactFibonacciHeap
+: public HeapBase<CompactFibonacciHeap<V, K, Compare>, V, K, std::uint32_t>
+{
+public:
+    /**
+     * @brief Index of no node, e.g. the parent of a root.
+     *
+     */
+    static const std::uint32_t NIL = 0xFFFFFFFF;
+
+private:
+    /*
+     * a node of rank r has at least phi^r descendants, hence ranks are
+     * bounded by log_phi(n) < 1.45 log_2(n) for 32 bit indices
+     */
+    static const int RANKS =
+        std::numeric_limits<std::uint32_t>::digits * 3 / 2 + 2;
+
+    static_assert(RANKS <= std::numeric_limits<std::uint64_t>::digits,
+        "rank table must be indexable by a 64 bit mask");
+
+    std::vector<CFNode<V, K>> nodes;
+    std::uint32_t freeList;
+
+    std::uint32_t forest;
+    std::uint32_t minPtr;
+    int count;
+
+    // rank table of _unionByRank, empty between consolidations
+    std::uint32_t ranks[RANKS];
+    std::uint64_t occupied;
+
+    Compare compare;
+
+public:
+    /**
+     * @brief Constructs a new compact fibonacci heap.
+     *
+     * @param compare The ordering of keys
+     */
+    explicit CompactFibonacciHeap(const Compare& compare = Compare())
+    : compare(compare)
+    {
+        _init();
+    }
+
+    /**
+     * @brief Deletes all nodes of the compact fibonacci heap.
+     *
+     * The capacity of the node array is kept for subsequent insertions.
+     *
+     * Runtime: \f$ O(n) \f$ for non-trivial values, \f$ O(1) \f$ otherwise
+     */
+    void clear()
+    {
+        nodes.clear();
+        _init();
+    }
+
+    /**
+     * @brief Reserves space for a number of nodes.
+     *
+     * Insertions do not reallocate the node array until more than `n` nodes
+     * are in use.
+     *
+     * @param n Number of nodes to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        assert(n < NIL);
+
+        nodes.reserve(n);
+    }
+
+    /**
+     * @brief Determines the current size of the compact fibonacci heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the compact fibonacci heap.
+     *
+     * The new node is taken from the free list or appended to the node array
+     * and becomes a new tree of the forest.
+     *
+     * Runtime: \f$ O(1) \f$ amortized
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return The index of the resulting heap node
+     */
+    std::uint32_t insert(V element, K key)
+    {
+        std::uint32_t handle = _allocate();
+
+        CFNode<V, K>& node = nodes[handle];
+        node.parent = NIL;
+        node.child = NIL;
+        node.rank = 0;
+        node.marked = 0;
+        node.value = std::move(element);
+        node.key = std::move(key);
+
+        _newTree(handle);
+        ++count;
+
+        return handle;
+    }
+
+    /**
+     * @brief Determines the value of the node with the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return A reference to the value of the smallest element, valid until
+     * the next insertion
+     */
+    const V& min()
+    {
+        assert(minPtr != NIL);
+
+        return nodes[minPtr].value;
+    }
+
+    /**
+     * @brief Deletes the heap node with smallest key and returns its value.
+     *
+     * Runtime: \f$ O(\log n) \f$ amortized
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(minPtr != NIL);
+
+        V value = std::move(nodes[minPtr].value);
+
+        _deleteRoot(minPtr);
+
+        return value;
+    }
+
+    /**
+     * @brief Removes a given node from the compact fibonacci heap.
+     *
+     * If the node is not a root, it is cut from its parent, cascading as for
+     * decreasing keys. Afterwards, the node is deleted as a root.
+     *
+     * Runtime: \f$ O(\log n) \f$ amortized
+     *
+     * @param handle Index of the node to remove
+     * @return Value of the deleted node
+     */
+    V remove(std::uint32_t handle)
+    {
+        V value = std::move(nodes[handle].value);
+
+        if (nodes[handle].parent != NIL)
+        {
+            _cascadingCut(handle);
+        }
+
+        _deleteRoot(handle);
+
+        return value;
+    }
+
+    /**
+     * @brief Decreases the key of a given heap node.
+     *
+     * If the heap order is violated, the node is cut from its parent, which
+     * is cut as well if it is already marked, and so on.
+     *
+     * Runtime: \f$ O(1) \f$ amortized
+     *
+     * @param handle Index of the heap node
+     * @param key New key value of the heap node
+     */
+    void decreaseKey(std::uint32_t handle, K key);
+
+    /**
+     * @brief Merges two instances of compact fibonacci heaps.
+     *
+     * The nodes of `heap` are appended to the node array of this heap and
+     * both forests are united, leaving `heap` empty. Hence, a handle `h` of
+     * `heap` becomes `h + offset`, where `offset` is the size of the node
+     * array of this heap before merging. If this heap has no nodes, both
+     * arrays are swapped and handles remain valid.
+     *
+     * Runtime: \f$ O(m) \f$ for \f$ m \f$ nodes of `heap`, \f$ O(1) \f$ if
+     * this heap has no nodes
+     *
+     * @param heap Pointer to the compact fibonacci heap to merge with
+     */
+    void merge(CompactFibonacciHeap<V, K, Compare>* heap);
+
+    /**
+     * @brief Gets the index of one root of the forest.
+     *
+     * @return The index of the first tree in the forest, or `NIL`
+     */
+    std::uint32_t getForest()
+    {
+        return forest;
+    }
+
+    /**
+     * @brief Gets the index of the node with the smallest key.
+     *
+     * @return The index of the smallest element, or `NIL`
+     */
+    std::uint32_t getMinPtr()
+    {
+        return minPtr;
+    }
+
+    /**
+     * @brief Gets the heap node with a given index.
+     *
+     * @param handle Index of the heap node
+     * @return A reference to the heap node, valid until the next insertion
+     */
+    const CFNode<V, K>& getNode(std::uint32_t handle)
+    {
+        return nodes[handle];
+    }
+
+    /**
+     * @brief Gets the node array of the heap, including free nodes.
+     *
+     * @return A reference to the node array
+     */
+    const std::vector<CFNode<V, K>>& getNodes()
+    {
+        return nodes;
+    }
+
+private:
+    void _init();
+
+    std::uint32_t _allocate();
+
+    void _free(std::uint32_t handle);
+
+    void _newTree(std::uint32_t handle);
+
+    void _insertForest(std::uint32_t other);
+
+    void _cut(std::uint32_t handle);
+
+    void _link(std::uint32_t a, std::uint32_t b);
+
+    void _cascadingCut(std::uint32_t handle);
+
+    void _unionByRank();
+
+    void _insertByRank(std::uint32_t handle);
+
+    void _removeRoot(std::uint32_t handle);
+
+    void _deleteRoot(std::uint32_t handle);
+};
+
+#include "CompactFibonacciHeap.hpp"
@@ -0,0 +1,381 @@
+template<class V, class K, class Compare>
+const std::uint32_t CompactFibonacciHeap<V, K, Compare>::NIL;
+
+template<class V, class K, class Compare>
+const int CompactFibonacciHeap<V, K, Compare>::RANKS;
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_init()
+{
+    freeList = NIL;
+    forest = NIL;
+    minPtr = NIL;
+    count = 0;
+
+    for (int i = 0; i < RANKS; ++i)
+    {
+        ranks[i] = NIL;
+    }
+    occupied = 0;
+}
+
+template<class V, class K, class Compare>
+std::uint32_t CompactFibonacciHeap<V, K, Compare>::_allocate()
+{
+    if (freeList != NIL)
+    {
+        std::uint32_t handle = freeList;
+        freeList = nodes[handle].right;
+
+        return handle;
+    }
+
+    assert(nodes.size() < NIL);
+
+    nodes.push_back(CFNode<V, K>());
+
+    return static_cast<std::uint32_t>(nodes.size() - 1);
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_free(std::uint32_t handle)
+{
+    nodes[handle].right = freeList;
+    freeList = handle;
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_newTree(std::uint32_t handle)
+{
+    CFNode<V, K>& node = nodes[handle];
+
+    if (forest == NIL)
+    {
+        node.left = handle;
+        node.right = handle;
+        forest = handle;
+        minPtr = handle;
+
+        return;
+    }
+
+    std::uint32_t end = nodes[forest].left;
+    nodes[forest].left = handle;
+    node.left = end;
+    node.right = forest;
+    nodes[end].right = handle;
+
+    if (compare(node.key, nodes[minPtr].key))
+    {
+        minPtr = handle;
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_insertForest(std::uint32_t other)
+{
+    if (other == NIL)
+    {
+        return;
+    }
+
+    if (forest == NIL)
+    {
+        forest = other;
+
+        return;
+    }
+
+    // insert other forest into heap
+    std::uint32_t end = nodes[forest].left;
+    std::uint32_t otherEnd = nodes[other].left;
+    nodes[forest].left = otherEnd;
+    nodes[otherEnd].right = forest;
+    nodes[other].left = end;
+    nodes[end].right = other;
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_cut(std::uint32_t handle)
+{
+    CFNode<V, K>& node = nodes[handle];
+    CFNode<V, K>& parent = nodes[node.parent];
+
+    // advance child pointer of parent
+    if (parent.child == handle)
+    {
+        parent.child = (node.right != handle) ? node.right : NIL;
+    }
+
+    // remove subtree rooted at handle
+    nodes[node.right].left = node.left;
+    nodes[node.left].right = node.right;
+
+    node.parent = NIL;
+    node.marked = 0;
+    --parent.rank;
+
+    // insert handle as new tree
+    _newTree(handle);
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_link(std::uint32_t a,
+    std::uint32_t b)
+{
+    CFNode<V, K>& root = nodes[a];
+    CFNode<V, K>& node = nodes[b];
+
+    if (root.child != NIL)
+    {
+        // insert b as child at end of children
+        std::uint32_t end = nodes[root.child].left;
+        node.left = end;
+        nodes[root.child].left = b;
+        node.right = root.child;
+        nodes[end].right = b;
+    }
+    else
+    {
+        root.child = b;
+        node.left = b;
+        node.right = b;
+    }
+
+    node.parent = a;
+    node.marked = 0;
+
+    // increment rank of surviving root
+    ++root.rank;
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_cascadingCut(std::uint32_t handle)
+{
+    // cut until reaching a root or an unmarked parent
+    while (nodes[handle].parent != NIL)
+    {
+        std::uint32_t parent = nodes[handle].parent;
+
+        _cut(handle);
+
+        // roots are never marked
+        if (nodes[parent].parent == NIL)
+        {
+            return;
+        }
+
+        if (!nodes[parent].marked)
+        {
+            nodes[parent].marked = 1;
+
+            return;
+        }
+
+        handle = parent;
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_unionByRank()
+{
+    // detach every tree from the forest and insert it by rank
+    std::uint32_t current = forest;
+    nodes[nodes[forest].left].right = NIL;
+    forest = NIL;
+    minPtr = NIL;
+
+    while (current != NIL)
+    {
+        std::uint32_t handle = current;
+        current = nodes[current].right;
+
+        _insertByRank(handle);
+    }
+
+    // rebuild the forest from the surviving roots and empty the rank table
+    while (occupied)
+    {
+        int rank = lowestBit(occupied);
+        occupied &= occupied - 1;
+
+        _newTree(ranks[rank]);
+        ranks[rank] = NIL;
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_insertByRank(std::uint32_t handle)
+{
+    // link trees of equal rank until the rank of the survivor is free
+    while (true)
+    {
+        int rank = nodes[handle].rank;
+        assert(rank < RANKS);
+
+        std::uint32_t collision = ranks[rank];
+        if (collision == NIL)
+        {
+            ranks[rank] = handle;
+            occupied |= std::uint64_t(1) << rank;
+
+            return;
+        }
+
+        ranks[rank] = NIL;
+        occupied &= ~(std::uint64_t(1) << rank);
+
+        if (compare(nodes[handle].key, nodes[collision].key))
+        {
+            _link(handle, collision);
+        }
+        else
+        {
+            _link(collision, handle);
+            handle = collision;
+        }
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_removeRoot(std::uint32_t handle)
+{
+    CFNode<V, K>& node = nodes[handle];
+
+    if (node.right == handle)
+    {
+        forest = NIL;
+    }
+    else
+    {
+        nodes[node.left].right = node.right;
+        nodes[node.right].left = node.left;
+
+        if (forest == handle)
+        {
+            forest = node.right;
+        }
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::_deleteRoot(std::uint32_t handle)
+{
+    std::uint32_t child = nodes[handle].child;
+
+    // add children as new trees
+    if (child != NIL)
+    {
+        std::uint32_t current = child;
+        do
+        {
+            nodes[current].parent = NIL;
+            nodes[current].marked = 0;
+            current = nodes[current].right;
+        }
+        while (current != child);
+    }
+
+    _removeRoot(handle);
+    _insertForest(child);
+    _free(handle);
+
+    --count;
+    minPtr = NIL;
+
+    if (forest != NIL)
+    {
+        _unionByRank();
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::decreaseKey(std::uint32_t handle,
+    K key)
+{
+    CFNode<V, K>& node = nodes[handle];
+    if (!compare(key, node.key))
+    {
+        return;
+    }
+
+    node.key = std::move(key);
+
+    // cut only if heap order is violated
+    if (node.parent != NIL)
+    {
+        if (compare(node.key, nodes[node.parent].key))
+        {
+            _cascadingCut(handle);
+        }
+    }
+    else if (compare(node.key, nodes[minPtr].key))
+    {
+        minPtr = handle;
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactFibonacciHeap<V, K, Compare>::merge(
+    CompactFibonacciHeap<V, K, Compare>* heap)
+{
+    if (heap == this || heap->count == 0)
+    {
+        return;
+    }
+
+    if (nodes.empty())
+    {
+        nodes.swap(heap->nodes);
+        freeList = heap->freeList;
+        forest = heap->forest;
+        minPtr = heap->minPtr;
+        count = heap->count;
+
+        heap->clear();
+
+        return;
+    }
+
+    assert(nodes.size() + heap->nodes.size() < NIL);
+
+    // append all nodes of the other heap, shifting their indices
+    std::uint32_t offset = static_cast<std::uint32_t>(nodes.size());
+    nodes.reserve(nodes.size() + heap->nodes.size());
+
+    for (std::size_t i = 0; i < heap->nodes.size(); ++i)
+    {
+        CFNode<V, K>& node = heap->nodes[i];
+
+        node.parent = (node.parent != NIL) ? node.parent + offset : NIL;
+        node.left = (node.left != NIL) ? node.left + offset : NIL;
+        node.right = (node.right != NIL) ? node.right + offset : NIL;
+        node.child = (node.child != NIL) ? node.child + offset : NIL;
+
+        nodes.push_back(std::move(node));
+    }
+
+    // prepend the free list of the other heap
+    if (heap->freeList != NIL)
+    {
+        std::uint32_t end = heap->freeList + offset;
+        while (nodes[end].right != NIL)
+        {
+            end = nodes[end].right;
+        }
+
+        nodes[end].right = freeList;
+        freeList = heap->freeList + offset;
+    }
+
+    std::uint32_t other = heap->minPtr + offset;
+    if (minPtr == NIL || compare(nodes[other].key, nodes[minPtr].key))
+    {
+        minPtr = other;
+    }
+
+    _insertForest(heap->forest + offset);
+    count += heap->count;
+
+    heap->clear();
+}
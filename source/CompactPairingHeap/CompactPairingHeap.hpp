@@ -0,0 +1,348 @@
+template<class V, class K, class Compare>
+const std::uint32_t CompactPairingHeap<V, K, Compare>::NIL;
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_init()
+{
+    freeList = NIL;
+    forest = NIL;
+    minPtr = NIL;
+    count = 0;
+}
+
+template<class V, class K, class Compare>
+std::uint32_t CompactPairingHeap<V, K, Compare>::_allocate()
+{
+    if (freeList != NIL)
+    {
+        std::uint32_t handle = freeList;
+        freeList = nodes[handle].right;
+
+        return handle;
+    }
+
+    assert(nodes.size() < NIL);
+
+    nodes.push_back(CPNode<V, K>());
+
+    return static_cast<std::uint32_t>(nodes.size() - 1);
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_free(std::uint32_t handle)
+{
+    nodes[handle].right = freeList;
+    freeList = handle;
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_newTree(std::uint32_t handle)
+{
+    CPNode<V, K>& node = nodes[handle];
+
+    if (forest == NIL)
+    {
+        node.left = handle;
+        node.right = handle;
+        forest = handle;
+        minPtr = handle;
+
+        return;
+    }
+
+    std::uint32_t end = nodes[forest].left;
+    nodes[forest].left = handle;
+    node.left = end;
+    node.right = forest;
+    nodes[end].right = handle;
+
+    if (compare(node.key, nodes[minPtr].key))
+    {
+        minPtr = handle;
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_insertForest(std::uint32_t other)
+{
+    if (other == NIL)
+    {
+        return;
+    }
+
+    if (forest == NIL)
+    {
+        forest = other;
+
+        return;
+    }
+
+    // insert other forest into heap
+    std::uint32_t end = nodes[forest].left;
+    std::uint32_t otherEnd = nodes[other].left;
+    nodes[forest].left = otherEnd;
+    nodes[otherEnd].right = forest;
+    nodes[other].left = end;
+    nodes[end].right = other;
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_cut(std::uint32_t handle)
+{
+    CPNode<V, K>& node = nodes[handle];
+    CPNode<V, K>& parent = nodes[node.parent];
+
+    // advance child pointer of parent
+    if (parent.child == handle)
+    {
+        parent.child = (node.right != handle) ? node.right : NIL;
+    }
+
+    // remove subtree rooted at handle
+    nodes[node.right].left = node.left;
+    nodes[node.left].right = node.right;
+
+    node.parent = NIL;
+
+    // insert handle as new tree
+    _newTree(handle);
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_link(std::uint32_t a,
+    std::uint32_t b)
+{
+    CPNode<V, K>& root = nodes[a];
+    CPNode<V, K>& node = nodes[b];
+
+    nodes[node.left].right = node.right;
+    nodes[node.right].left = node.left;
+
+    if (root.child != NIL)
+    {
+        // insert b as child at end of children
+        std::uint32_t end = nodes[root.child].left;
+        node.left = end;
+        nodes[root.child].left = b;
+        node.right = root.child;
+        nodes[end].right = b;
+    }
+    else
+    {
+        root.child = b;
+        node.left = b;
+        node.right = b;
+    }
+
+    node.parent = a;
+}
+
+template<class V, class K, class Compare>
+std::uint32_t CompactPairingHeap<V, K, Compare>::_union(std::uint32_t a,
+    std::uint32_t b)
+{
+    assert(nodes[a].parent == NIL);
+    assert(nodes[b].parent == NIL);
+
+    if (compare(nodes[a].key, nodes[b].key))
+    {
+        _link(a, b);
+
+        return a;
+    }
+    else
+    {
+        _link(b, a);
+
+        return b;
+    }
+}
+
+template<class V, class K, class Compare>
+std::uint32_t CompactPairingHeap<V, K, Compare>::_pop(std::uint32_t& list)
+{
+    std::uint32_t handle = list;
+    list = nodes[handle].right;
+
+    nodes[handle].left = handle;
+    nodes[handle].right = handle;
+
+    return handle;
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_removeRoot(std::uint32_t handle)
+{
+    CPNode<V, K>& node = nodes[handle];
+
+    if (node.right == handle)
+    {
+        forest = NIL;
+    }
+    else
+    {
+        nodes[node.left].right = node.right;
+        nodes[node.right].left = node.left;
+
+        if (forest == handle)
+        {
+            forest = node.right;
+        }
+    }
+
+    node.left = handle;
+    node.right = handle;
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_deleteRoot(std::uint32_t handle)
+{
+    // detach children as a linear list
+    std::uint32_t children = nodes[handle].child;
+    if (children != NIL)
+    {
+        std::uint32_t current = children;
+        do
+        {
+            nodes[current].parent = NIL;
+            current = nodes[current].right;
+        }
+        while (current != children);
+
+        nodes[nodes[children].left].right = NIL;
+        nodes[handle].child = NIL;
+    }
+
+    _removeRoot(handle);
+    _free(handle);
+
+    --count;
+
+    // detach remaining roots as a linear list behind the children
+    std::uint32_t roots = forest;
+    if (roots != NIL)
+    {
+        nodes[nodes[roots].left].right = NIL;
+    }
+
+    forest = NIL;
+    minPtr = NIL;
+
+    if (children == NIL)
+    {
+        _pair(roots);
+    }
+    else
+    {
+        nodes[nodes[children].left].right = roots;
+        _pair(children);
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::_pair(std::uint32_t list)
+{
+    // perform pair-wise union operations from left to right
+    while (list != NIL)
+    {
+        std::uint32_t handle = _pop(list);
+
+        if (list != NIL)
+        {
+            handle = _union(handle, _pop(list));
+        }
+
+        _newTree(handle);
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::decreaseKey(std::uint32_t handle,
+    K key)
+{
+    CPNode<V, K>& node = nodes[handle];
+    if (!compare(key, node.key))
+    {
+        return;
+    }
+
+    node.key = std::move(key);
+
+    /*
+     * cut subtree rooted at handle if handle is not a root
+     * otherwise update minPtr
+     */
+    if (node.parent != NIL)
+    {
+        _cut(handle);
+    }
+    else if (compare(node.key, nodes[minPtr].key))
+    {
+        minPtr = handle;
+    }
+}
+
+template<class V, class K, class Compare>
+void CompactPairingHeap<V, K, Compare>::merge(
+    CompactPairingHeap<V, K, Compare>* heap)
+{
+    if (heap == this || heap->count == 0)
+    {
+        return;
+    }
+
+    if (nodes.empty())
+    {
+        nodes.swap(heap->nodes);
+        freeList = heap->freeList;
+        forest = heap->forest;
+        minPtr = heap->minPtr;
+        count = heap->count;
+
+        heap->clear();
+
+        return;
+    }
+
+    assert(nodes.size() + heap->nodes.size() < NIL);
+
+    // append all nodes of the other heap, shifting their indices
+    std::uint32_t offset = static_cast<std::uint32_t>(nodes.size());
+    nodes.reserve(nodes.size() + heap->nodes.size());
+
+    for (std::size_t i = 0; i < heap->nodes.size(); ++i)
+    {
+        CPNode<V, K>& node = heap->nodes[i];
+
+        node.parent = (node.parent != NIL) ? node.parent + offset : NIL;
+        node.left = (node.left != NIL) ? node.left + offset : NIL;
+        node.right = (node.right != NIL) ? node.right + offset : NIL;
+        node.child = (node.child != NIL) ? node.child + offset : NIL;
+
+        nodes.push_back(std::move(node));
+    }
+
+    // prepend the free list of the other heap
+    if (heap->freeList != NIL)
+    {
+        std::uint32_t end = heap->freeList + offset;
+        while (nodes[end].right != NIL)
+        {
+            end = nodes[end].right;
+        }
+
+        nodes[end].right = freeList;
+        freeList = heap->freeList + offset;
+    }
+
+    std::uint32_t other = heap->minPtr + offset;
+    if (minPtr == NIL || compare(nodes[other].key, nodes[minPtr].key))
+    {
+        minPtr = other;
+    }
+
+    _insertForest(heap->forest + offset);
+    count += heap->count;
+
+    heap->clear();
+}
@@ -0,0 +1,384 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/AlignedAllocator.h"
+#include "../memory/NodePool.h"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+template<class V, class K, unsigned D> class DAryHeap;
+
+/**
+ * @brief Template for handles of d-ary heaps.
+ *
+ * D-ary heap nodes store the value of an element and its current position in
+ * the array of the heap. Keys are stored within the array itself, such that
+ * sifting never touches the nodes of elements that are only compared.
+ *
+ * Nodes never move in memory, hence handles remain valid until the element
+ * is deleted.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct DNode : public INode<V, K>
+{
+public:
+    template<class, class, unsigned> friend class DAryHeap;
+
+    /**
+     * @brief Gets the value of the heap node.
+     *
+     * @return The value stored in the heap node
+     */
+    V getValue()
+    {
+        return value;
+    }
+
+    /**
+     * @brief Gets the current position of the heap node in the array.
+     *
+     * @return The array index of the heap node
+     */
+    std::size_t getPosition()
+    {
+        return position;
+    }
+
+private:
+    V value;
+    std::size_t position;
+};
+
+/**
+ * @brief Template for addressable d-ary heap data structures.
+ *
+ * D-ary heaps store a complete d-ary tree in an array. Every array entry
+ * holds a key and a pointer to the node of its element, which in turn knows
+ * its array position. This position map allows `decreaseKey` and `remove`
+ * through stable handles.
+ *
+ * The array is aligned to cache lines and shifted by `D - 1` entries, such
+ * that all children of a node share as few cache lines as possible. With
+ * 16 byte entries, the children of a node fill exactly one cache line for
+ * `D = 4` and two for `D = 8`.
+ *
+ * This results in logarithmic time for deletions and decreasing keys as
+ * well as for insertions, with small constants and no pointer chasing.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @tparam D Template parameter for the degree of the tree
+ */
+template<class V, class K, unsigned D = 4>
+class DAryHeap
+: public HeapBase<DAryHeap<V, K, D>, V, K, DNode<V, K>*>
+{
+    static_assert(D >= 2, "DAryHeap requires a degree of at least two");
+
+private:
+    struct Entry
+    {
+        K key;
+        DNode<V, K>* node;
+    };
+
+    static const std::size_t OFFSET = D - 1;
+
+    std::vector<Entry, AlignedAllocator<Entry>> entries;
+
+    std::shared_ptr<NodePool<DNode<V, K>>> pool;
+
+public:
+    /**
+     * @brief Constructs a new d-ary heap with its own node pool.
+     *
+     */
+    DAryHeap()
+    : pool(std::make_shared<NodePool<DNode<V, K>>>())
+    {
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new d-ary heap allocating from a given pool.
+     *
+     * @param pool The node pool to allocate nodes from
+     */
+    explicit DAryHeap(std::shared_ptr<NodePool<DNode<V, K>>> pool)
+    : pool(pool)
+    {
+        assert(pool);
+
+        _init();
+    }
+
+    DAryHeap(const DAryHeap&) = delete;
+    DAryHeap& operator=(const DAryHeap&) = delete;
+
+    /**
+     * @brief Destroys the d-ary heap and all of its nodes.
+     *
+     */
+    ~DAryHeap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the d-ary heap.
+     *
+     * If the heap is the only user of its node pool and nodes are trivially
+     * destructible, all slabs are released at once. Otherwise, every node is
+     * destroyed and returned to the pool separately.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(n) \f$, respectively
+     */
+    void clear();
+
+    /**
+     * @brief Reserves space for a number of elements.
+     *
+     * Neither the array nor the node pool grow until more than `n` elements
+     * are in the heap.
+     *
+     * @param n Number of elements to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        entries.reserve(OFFSET + n);
+        pool->reserve(n);
+    }
+
+    /**
+     * @brief Builds a d-ary heap from a set of values with associated keys.
+     *
+     * Both sets must have the same length. This implementation assumes that
+     * the following property holds for all indices `i`:
+     *
+     * `key[i]` is the key associated with `elements[i]`.
+     *
+     * This implementation appends all key-value-pairs and restores the heap
+     * property bottom-up.
+     *
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param elements Vector of values to insert
+     * @param keys Vector of keys
+     */
+    void build(std::vector<V>& elements, std::vector<K>& keys)
+    {
+        assert(elements.size() == keys.size());
+
+        build(elements.begin(), elements.end(), keys.begin());
+    }
+
+    /**
+     * @brief Inserts a range of values with associated keys at once.
+     *
+     * The value at position `i` of the range `[first, last)` is associated
+     * with the key at position `i` behind `keys`. Values are copied into the
+     * heap nodes or moved if `first` and `last` are move iterators.
+     *
+     * All nodes are allocated within one contiguous slab. Afterwards, the
+     * heap property is restored bottom-up for the whole array.
+     *
+     * Runtime: \f$ O(n + m) \f$ for \f$ m \f$ new elements
+     *
+     * @tparam ValueIterator Template parameter for forward iterators of values
+     * @tparam KeyIterator Template parameter for input iterators of keys
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     * @return Pointers to the new heap nodes in the order of the range
+     */
+    template<class ValueIterator, class KeyIterator>
+    std::vector<DNode<V, K>*> build(
+        ValueIterator first, ValueIterator last, KeyIterator keys)
+    {
+        std::vector<DNode<V, K>*> nodes;
+        pool->allocateBulk(std::distance(first, last), nodes);
+
+        entries.reserve(entries.size() + nodes.size());
+        for (std::size_t i = 0; first != last; ++first, ++keys, ++i)
+        {
+            DNode<V, K>* node = new (nodes[i]) DNode<V, K>;
+            node->value = *first;
+            node->position = entries.size();
+
+            Entry entry = { *keys, node };
+            entries.push_back(entry);
+        }
+
+        _heapify();
+
+        return nodes;
+    }
+
+    /**
+     * @brief Determines the current size of the d-ary heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return static_cast<int>(entries.size() - OFFSET);
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the d-ary heap.
+     *
+     * The new entry is appended to the array and sifted up.
+     *
+     * Runtime: \f$ O(\log_D n) \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return A pointer to the resulting heap node
+     */
+    DNode<V, K>* insert(V element, K key)
+    {
+        DNode<V, K>* node = new (pool->allocate()) DNode<V, K>;
+        node->value = element;
+        node->position = entries.size();
+
+        Entry entry = { key, node };
+        entries.push_back(entry);
+
+        _siftUp(node->position);
+
+        return node;
+    }
+
+    /**
+     * @brief Determines the value of the node with the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return Value of the smallest element
+     */
+    V min()
+    {
+        assert(size() > 0);
+
+        return entries[OFFSET].node->value;
+    }
+
+    /**
+     * @brief Determines the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The smallest key
+     */
+    K minKey()
+    {
+        assert(size() > 0);
+
+        return entries[OFFSET].key;
+    }
+
+    /**
+     * @brief Deletes the heap node with smallest key and returns its value.
+     *
+     * Runtime: \f$ O(D \log_D n) \f$
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(size() > 0);
+
+        return remove(entries[OFFSET].node);
+    }
+
+    /**
+     * @brief Removes a given node from the d-ary heap.
+     *
+     * The last entry of the array takes the place of the removed entry and
+     * is sifted up or down.
+     *
+     * Runtime: \f$ O(D \log_D n) \f$
+     *
+     * @param handle Pointer to the node to remove
+     * @return Value of the deleted node
+     */
+    V remove(DNode<V, K>* handle);
+
+    /**
+     * @brief Decreases the key of a given heap node.
+     *
+     * Runtime: \f$ O(\log_D n) \f$
+     *
+     * @param handle Pointer to the heap node
+     * @param key New key value of the heap node
+     */
+    void decreaseKey(DNode<V, K>* handle, K key)
+    {
+        if (key < entries[handle->position].key)
+        {
+            entries[handle->position].key = key;
+            _siftUp(handle->position);
+        }
+    }
+
+    /**
+     * @brief Gets the key associated with a given heap node.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param handle Pointer to the heap node
+     * @return The key associated with the heap node
+     */
+    K getKey(DNode<V, K>* handle)
+    {
+        return entries[handle->position].key;
+    }
+
+    /**
+     * @brief Merges two instances of d-ary heaps.
+     *
+     * All entries of `heap` are appended to the array and `heap` is left
+     * empty. Handles of `heap` remain valid. Node pools are transferred or
+     * retained as for the pointer-based heaps.
+     *
+     * Runtime: \f$ O(n + m) \f$
+     *
+     * @param heap Pointer to the d-ary heap to merge with
+     */
+    void merge(DAryHeap<V, K, D>* heap);
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     *
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<DNode<V, K>>> getPool()
+    {
+        return pool;
+    }
+
+private:
+    void _init();
+
+    void _free(DNode<V, K>* handle);
+
+    void _siftUp(std::size_t position);
+
+    void _siftDown(std::size_t position);
+
+    void _heapify();
+};
+
+#include "DAryHeap.hpp"
@@ -0,0 +1,181 @@
+template<class V, class K, unsigned D>
+const std::size_t DAryHeap<V, K, D>::OFFSET;
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::_init()
+{
+    // the first D - 1 entries are padding
+    entries.clear();
+    entries.resize(OFFSET);
+}
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::clear()
+{
+    if (pool.use_count() == 1
+        && std::is_trivially_destructible<DNode<V, K>>::value)
+    {
+        pool->release();
+    }
+    else
+    {
+        for (std::size_t i = OFFSET; i < entries.size(); ++i)
+        {
+            _free(entries[i].node);
+        }
+    }
+
+    _init();
+}
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::_free(DNode<V, K>* handle)
+{
+    handle->~DNode<V, K>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K, unsigned D>
+V DAryHeap<V, K, D>::remove(DNode<V, K>* handle)
+{
+    std::size_t position = handle->position;
+    V value = handle->value;
+
+    // move last entry into the gap
+    Entry last = entries.back();
+    entries.pop_back();
+
+    if (position < entries.size())
+    {
+        K key = entries[position].key;
+
+        entries[position] = last;
+        last.node->position = position;
+
+        if (last.key < key)
+        {
+            _siftUp(position);
+        }
+        else
+        {
+            _siftDown(position);
+        }
+    }
+
+    _free(handle);
+
+    return value;
+}
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::merge(DAryHeap<V, K, D>* heap)
+{
+    if (heap == this || heap->size() == 0)
+    {
+        return;
+    }
+
+    if (heap->pool != pool)
+    {
+        if (heap->pool.use_count() == 1)
+        {
+            pool->splice(*heap->pool);
+        }
+        else
+        {
+            pool->retain(heap->pool);
+        }
+    }
+
+    entries.reserve(entries.size() + heap->size());
+    for (std::size_t i = OFFSET; i < heap->entries.size(); ++i)
+    {
+        heap->entries[i].node->position = entries.size();
+        entries.push_back(heap->entries[i]);
+    }
+
+    heap->_init();
+
+    _heapify();
+}
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::_siftUp(std::size_t position)
+{
+    Entry entry = entries[position];
+
+    // move parents down until the hole reaches the position of entry
+    while (position > OFFSET)
+    {
+        std::size_t parent = (position - OFFSET - 1) / D + OFFSET;
+
+        if (!(entry.key < entries[parent].key))
+        {
+            break;
+        }
+
+        entries[position] = entries[parent];
+        entries[position].node->position = position;
+        position = parent;
+    }
+
+    entries[position] = entry;
+    entry.node->position = position;
+}
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::_siftDown(std::size_t position)
+{
+    Entry entry = entries[position];
+    std::size_t n = entries.size();
+
+    // move smallest children up until the hole reaches the position of entry
+    while (true)
+    {
+        std::size_t first = D * (position - OFFSET + 1);
+        if (first >= n)
+        {
+            break;
+        }
+
+        std::size_t last = (first + D < n) ? first + D : n;
+        std::size_t min = first;
+        for (std::size_t child = first + 1; child < last; ++child)
+        {
+            if (entries[child].key < entries[min].key)
+            {
+                min = child;
+            }
+        }
+
+        if (!(entries[min].key < entry.key))
+        {
+            break;
+        }
+
+        entries[position] = entries[min];
+        entries[position].node->position = position;
+        position = min;
+    }
+
+    entries[position] = entry;
+    entry.node->position = position;
+}
+
+template<class V, class K, unsigned D>
+void DAryHeap<V, K, D>::_heapify()
+{
+    std::size_t n = entries.size();
+    if (n <= OFFSET + 1)
+    {
+        return;
+    }
+
+    // sift down all inner nodes, starting with the last one
+    std::size_t position = (n - OFFSET - 2) / D + OFFSET + 1;
+    while (position > OFFSET)
+    {
+        --position;
+        _siftDown(position);
+    }
+}
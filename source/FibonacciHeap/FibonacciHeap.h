@@ -1,8 +1,30 @@
 #pragma once
 
-#include "../interface/IHeap.h"
-
-template<class V, class K> class FibonacciHeap;
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../memory/ValueLayout.h"
+#include "../util/Bits.h"
+#include "../util/HeapStats.h"
+#include "../util/Snapshot.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template<class V, class K, class Compare = std::less<K>, 
+    class Stats = NoStats, class Layout = InlineValues> 
+class FibonacciHeap;
 
 /**
  * @brief Template for nodes of a fibonacci heap.
@@ -15,19 +37,22 @@ template<class V, class K> class FibonacciHeap;
  * 
  * @tparam V Template parameter for value types
  * @tparam K Template parameter for key types
+ * @tparam Layout Template parameter for the node layout, either 
+ * `InlineValues` or `SplitValues`
  */
-template<class V, class K> 
+template<class V, class K, class Layout = InlineValues> 
 struct FNode : public INode<V, K> 
 {
 public:
-    friend class FibonacciHeap<V, K>;
+    template<class, class, class, class, class> 
+    friend class FibonacciHeap;
 
     /**
      * @brief Get the parent node.
      * 
      * @return A pointer to the parent node
      */
-    FNode<V, K>* getParent() 
+    FNode* getParent() 
     { 
         return parent; 
     }
@@ -37,7 +62,7 @@ public:
      * 
      * @return A pointer to the left sibling node
      */
-    FNode<V, K>* getLeft() 
+    FNode* getLeft() 
     { 
         return left; 
     }
@@ -47,7 +72,7 @@ public:
      * 
      * @return A pointer to the right sibling node
      */
-    FNode<V, K>* getRight() 
+    FNode* getRight() 
     { 
         return right; 
     }
@@ -57,7 +82,7 @@ public:
      * 
      * @return A pointer to one child node
      */
-    FNode<V, K>* getChild() 
+    FNode* getChild() 
     { 
         return child; 
     }
@@ -69,7 +94,7 @@ public:
      */
     V getValue() 
     { 
-        return value; 
+        return value.get(); 
     }
 
     /**
@@ -102,23 +127,30 @@ public:
         return marked; 
     }
 
-    bool hasChildren() override 
+    bool hasChildren() 
     { 
         return child; 
     }
 
-    bool hasParents() override 
+    bool hasParent() 
     { 
         return parent; 
     }
 
 private:
+    template<class... Args>
+    FNode(K key, typename Layout::template Store<V>& store, 
+        Args&&... args)
+    : value(store, std::forward<Args>(args)...), key(std::move(key))
+    {
+    }
+
     FNode* parent;
     FNode* left;
     FNode* right;
     FNode* child;
 
-    V value;
+    typename Layout::template Slot<V> value;
     K key;
 
     int rank;
@@ -133,40 +165,143 @@ private:
  * 
  * This results in amortized logarithmic time for deletions and amortized 
  * constant time for every other operation.
+ *
+ * Deleting the minimum consolidates the whole forest, which takes time linear 
+ * in the number of roots after a long run of insertions. With a work budget, 
+ * see `setBudget`, consolidation is spread over all operations instead, 
+ * which bounds the worst-case time of deletions.
+ *
+ * Values are stored within the nodes. The layout `SplitValues` keeps them in 
+ * a separate pool instead, such that restructuring the trees, which only 
+ * touches keys and links, works on compact nodes.
+ *
+ * All operations are statically dispatched. Use `HeapAdapter` to access the 
+ * heap through `IHeap`.
  * 
  * @tparam V Template parameter for value types
  * @tparam K Template parameter for key types
+ * @tparam Compare Template parameter for the strict weak ordering of keys, 
+ * the heap maintains the smallest key with respect to it
+ * @tparam Stats Template parameter for the instrumentation policy, either 
+ * `NoStats` or `CountingStats`
+ * @tparam Layout Template parameter for the node layout, either 
+ * `InlineValues` or `SplitValues`
  */
-template<class V, class K> 
-class FibonacciHeap : public IHeap<V, K>
+template<class V, class K, class Compare, class Stats, class Layout> 
+class FibonacciHeap 
+: public HeapBase<FibonacciHeap<V, K, Compare, Stats, Layout>, V, K, 
+    FNode<V, K, Layout>*>
 {
 private:
-    FNode<V, K>* forest;
-    FNode<V, K>* minPtr;
+    /*
+     * a root of rank r has at least phi^r descendants, hence ranks are 
+     * bounded by log_phi(n) < 1.45 log_2(n) for any count
+     */
+    static const int RANKS = std::numeric_limits<int>::digits * 3 / 2 + 2;
+
+    static_assert(RANKS <= std::numeric_limits<std::uint64_t>::digits,
+        "rank table must be indexable by a 64 bit mask");
+
+    FNode<V, K, Layout>* forest;
+    FNode<V, K, Layout>* minPtr;
     int count;
 
+    /*
+     * rank table of _unionByRank, empty between consolidations unless 
+     * consolidation is deamortized, see setBudget
+     */
+    FNode<V, K, Layout>* ranks[RANKS];
+    std::uint64_t occupied;
+
+    std::shared_ptr<NodePool<FNode<V, K, Layout>>> pool;
+
+    // values of the nodes, unless stored within the nodes
+    typename Layout::template Store<V> values;
+
+    // auxiliary heap of deleteMinBatch, kept to reuse its memory
+    std::vector<FNode<V, K, Layout>*> candidates;
+
+    Compare compare;
+
+    Stats statistics;
+
+    // roots consolidated per operation, 0 for amortized consolidation
+    int budget;
+
 public:
     /**
-     * @brief Constructs a new fibonacci heap.
+     * @brief Constructs a new fibonacci heap with its own node pool.
+     * 
+     * @param compare The ordering of keys
+     */
+    explicit FibonacciHeap(const Compare& compare = Compare())
+    : pool(std::make_shared<NodePool<FNode<V, K, Layout>>>()), compare(compare)
+    {
+        budget = 0;
+
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new fibonacci heap allocating from a given pool.
+     *
+     * Heaps that are going to be merged should share one pool, such that 
+     * merging does not need to transfer or retain any slabs.
      * 
+     * @param pool The node pool to allocate nodes from
+     * @param compare The ordering of keys
      */
-    FibonacciHeap()
+    explicit FibonacciHeap(std::shared_ptr<NodePool<FNode<V, K, Layout>>> pool, 
+        const Compare& compare = Compare())
+    : pool(pool), compare(compare)
     {
+        assert(pool);
+
+        budget = 0;
+
         _init();
     }
 
+    FibonacciHeap(const FibonacciHeap&) = delete;
+    FibonacciHeap& operator=(const FibonacciHeap&) = delete;
+
     /**
      * @brief Destroys the fibonacci heap.
      *
-     * Recursively deletes all nodes of all trees maintained by the heap.
+     * Deletes all nodes of all trees maintained by the heap.
      * 
      */
-    virtual ~FibonacciHeap()
+    ~FibonacciHeap()
     {
-        if (forest)
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the fibonacci heap.
+     *
+     * If the heap is the only user of its node pool and nodes are trivially 
+     * destructible, all slabs are released at once. Otherwise, every node is 
+     * destroyed and returned to the pool separately.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(n) \f$, respectively
+     */
+    void clear()
+    {
+        _flushRanks();
+
+        if (pool.use_count() == 1 
+            && std::is_trivially_destructible<FNode<V, K, Layout>>::value
+            && values.releasable())
+        {
+            pool->release();
+            values.release();
+        }
+        else if (forest)
         {
             _deleteAll(forest);
         }
+
+        _init();
     }
 
     /**
@@ -177,23 +312,109 @@ public:
      *
      * `key[i]` is the key associated with `elements[i]`.
      *
-     * This implementation inserts every key-value-pair separately. 
+     * This implementation copies all key-value-pairs into the heap at once. 
      * 
-     * Runtime: \f$ O(\log n)\f$
+     * Runtime: \f$ O(n) \f$
      * 
-     * @param elements 
-     * @param keys 
+     * @param elements Vector of values to insert
+     * @param keys Vector of keys
      */
-    void build(std::vector<V>& elements, std::vector<K>& keys) override
+    void build(std::vector<V>& elements, std::vector<K>& keys)
     {
         assert(elements.size() == keys.size());
 
-        for (int i = 0; i < elements.size(); ++i)
+        build(elements.begin(), elements.end(), keys.begin());
+    }
+
+    /**
+     * @brief Inserts a range of values with associated keys at once.
+     *
+     * The value at position `i` of the range `[first, last)` is associated 
+     * with the key at position `i` behind `keys`. Values are copied into the 
+     * heap nodes or moved if `first` and `last` are move iterators, hence 
+     * move-only value types are supported.
+     *
+     * All nodes are allocated within one contiguous slab and linked into the 
+     * forest as new trees in a single pass, which also determines the new 
+     * minimum.
+     * 
+     * Runtime: \f$ O(n) \f$
+     * 
+     * @tparam ValueIterator Template parameter for forward iterators of values
+     * @tparam KeyIterator Template parameter for input iterators of keys
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     * @return Pointers to the new heap nodes in the order of the range
+     */
+    template<class ValueIterator, class KeyIterator>
+    std::vector<FNode<V, K, Layout>*> build(
+        ValueIterator first, ValueIterator last, KeyIterator keys)
+    {
+        std::vector<FNode<V, K, Layout>*> nodes;
+        pool->allocateBulk(std::distance(first, last), nodes);
+
+        for (std::size_t i = 0; first != last; ++first, ++keys, ++i)
         {
-            insert(elements[i], keys[i]);
+            new (nodes[i]) FNode<V, K, Layout>(*keys, values, *first);
         }
 
-        ++count;
+        _buildForest(nodes);
+
+        return nodes;
+    }
+
+    /**
+     * @brief Inserts a batch of values with associated keys.
+     *
+     * The value at position `i` of the range `[first, last)` is associated 
+     * with the key at position `i` behind `keys`.
+     *
+     * Every new node is allocated from the free list of the node pool and 
+     * appended to a new circular list in a single pass, which also determines 
+     * the minimum of the batch. The list is then spliced into the forest.
+     * 
+     * Runtime: \f$ O(m) \f$ for \f$ m \f$ new elements
+     * 
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     * @param handles Vector the pointers to the new heap nodes are appended to
+     */
+    template<class ValueIterator, class KeyIterator>
+    void insertBatch(ValueIterator first, ValueIterator last, KeyIterator keys, 
+        std::vector<FNode<V, K, Layout>*>& handles)
+    {
+        _insertBatch(first, last, keys, &handles);
+    }
+
+    /**
+     * @brief Inserts a batch of values with associated keys, discarding the 
+     * handles of the new heap nodes.
+     * 
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     */
+    template<class ValueIterator, class KeyIterator>
+    void insertBatch(ValueIterator first, ValueIterator last, KeyIterator keys)
+    {
+        _insertBatch(first, last, keys, 
+            static_cast<std::vector<FNode<V, K, Layout>*>*>(NULL));
+    }
+
+    /**
+     * @brief Reserves space for a number of elements.
+     * 
+     * Neither the node pool nor the value storage grow until more than `n` 
+     * elements are in the heap.
+     * 
+     * @param n Number of elements to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        pool->reserve(n);
+        values.reserve(n);
     }
 
     /**
@@ -203,7 +424,7 @@ public:
      * 
      * @return The current size of the heap
      */
-    int size() override
+    int size()
     {
         return count;
     }
@@ -212,21 +433,60 @@ public:
      * @brief Inserts a key-value-pair into the fibonacci heap.
      *
      * This implementation inserts a key-value-pair by inserting a new node 
-     * as a new tree into the forest.
+     * as a new tree into the forest. The value is copied into the node once.
      * 
      * Runtime: \f$ O(1) \f$
      * 
      * @param element Value to insert
      * @param key Key associated with `value`
-     * @return A pointer to the resulting pairing heap node
+     * @return A pointer to the resulting heap node
      */
-    INode<V, K>* insert(V element, K key) override
+    FNode<V, K, Layout>* insert(const V& element, const K& key)
     {
-        FNode<V, K>* handle = _singleton(element);
+        return emplace(key, element);
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the fibonacci heap, moving both 
+     * into the new node.
+     * 
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @param element Value to insert
+     * @param key Key associated with `value`
+     * @return A pointer to the resulting heap node
+     */
+    FNode<V, K, Layout>* insert(V&& element, K&& key)
+    {
+        return emplace(std::move(key), std::move(element));
+    }
+
+    /**
+     * @brief Inserts a value constructed in place from given arguments.
+     *
+     * The value is constructed in place, within the new node or within the 
+     * value storage of the heap, hence it is neither copied nor moved.
+     * 
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @param key Key associated with the new value
+     * @param args Arguments passed to the constructor of the value
+     * @return A pointer to the resulting heap node
+     */
+    template<class... Args>
+    FNode<V, K, Layout>* emplace(K key, Args&&... args)
+    {
+        FNode<V, K, Layout>* handle = _singleton(std::move(key), 
+            std::forward<Args>(args)...);
         _newTree(handle);
 
         ++count;
 
+        if (budget)
+        {
+            _consolidate(budget);
+        }
+
         return handle;
     }
 
@@ -235,48 +495,80 @@ public:
      * 
      * Runtime: \f$ O(1) \f$
      * 
-     * @return Value of the smallest element
+     * @return A reference to the value of the smallest element, valid until 
+     * the element is deleted
      */
-    V min() override
+    const V& min()
     {
-        return minPtr->getValue();
+        assert(minPtr);
+
+        return minPtr->value.get();
     }
 
     /**
      * @brief Deletes the heap node with smallest key and returns its value.
      * 
+     * The value is moved out of the node before the node is deleted.
+     * 
      * Runtime: \f$ O(\log n) \f$ amortized
      *
      * @return The value of the smallest element
      */
-    V deleteMin() override
+    V deleteMin()
     {
-        V value = minPtr->getValue();
+        assert(minPtr);
 
-        _deleteMin();
+        V value = std::move(minPtr->value.get());
 
-        count = (count > 0) ? count-- : 0;
+        _deleteRoot(minPtr);
 
         return value;
     }
 
+    /**
+     * @brief Deletes the `k` heap nodes with smallest keys.
+     *
+     * The values are appended to `out` in ascending order of their keys. If 
+     * the heap contains fewer than `k` nodes, all nodes are deleted.
+     *
+     * Instead of consolidating the forest after every deletion, all roots 
+     * are kept in an auxiliary binary heap. Deleting a node pushes its 
+     * children into the auxiliary heap. Afterwards, the remaining candidates 
+     * form the new forest, which is consolidated by rank once.
+     * 
+     * Runtime: \f$ O(r + k \log (r + k \log n)) \f$ for \f$ r \f$ roots
+     *
+     * @param k Number of nodes to delete
+     * @param out Vector the values are appended to
+     * @return The number of deleted nodes
+     */
+    int deleteMinBatch(int k, std::vector<V>& out);
+
     /**
      * @brief Removes a given node from the fibonacci heap.
      *
-     * The key associated with the node is first decreased such that the new key
-     * is smaller than any other key. Afterwards, the element with smallest key,
-     * i.e. the given node, is deleted.
+     * If the node is not a root, it is cut from its parent, cascading as for 
+     * decreasing keys. Afterwards, the node is deleted as a root. Its key is 
+     * never compared to a sentinel, hence any key type and order is 
+     * supported.
      * 
      * Runtime: \f$ O(\log n) \f$ amortized
      * 
      * @param handle Pointer to the node to remove
      * @return Value of the deleted node
      */
-    V remove(INode<V, K>* handle) override
+    V remove(FNode<V, K, Layout>* handle)
     {
-        decreaseKey(handle, minPtr->getKey() - 1);
+        V value = std::move(handle->value.get());
 
-        deleteMin();
+        if (handle->parent)
+        {
+            _cascadingCut(handle);
+        }
+
+        _deleteRoot(handle);
+
+        return value;
     }
 
     /**
@@ -287,41 +579,177 @@ public:
      * @param handle Pointer to the heap node 
      * @param key New key value of the heap node
      */
-    void decreaseKey(INode<V, K>* handle, V key) override
+    void decreaseKey(FNode<V, K, Layout>* handle, K key)
     {
-        if (key < handle->getKey())
+        statistics.comparison();
+        if (compare(key, handle->key))
         {
             _decreaseKey(handle, key);
         }
+
+        if (budget)
+        {
+            _consolidate(budget);
+        }
     }
 
     /**
      * @brief Merges two instances of fibonacci heaps.
      * 
-     * The new forest becomes the union of both forests.
+     * The new forest becomes the union of both forests and `heap` is left 
+     * empty. Nodes of `heap` move into this heap, hence their storage must 
+     * outlive this heap: if both heaps use different node pools, the slabs of 
+     * the other pool are either moved into the pool of this heap or, if the 
+     * other pool is still shared with further heaps, retained by it.
      *
-     * Runtime: \f$ O(1) \f$
+     * With a work budget, all trees of `heap` are consolidated right away, 
+     * such that deletions do not scan them.
      *
-     * @param other Pointer to the fibonacci heap to merge with
+     * Runtime: \f$ O(1) \f$ for shared pools, \f$ O(t + \log n) \f$ for 
+     * \f$ t \f$ trees with a work budget
+     *
+     * @param heap Pointer to the fibonacci heap to merge with
      */
-    void merge(IHeap<V, K>* other) override
+    void merge(FibonacciHeap<V, K, Compare, Stats, Layout>* heap)
     {
-        if (other->getMinPtr()->getKey() < minPtr->getKey())
+        if (heap == this)
+        {
+            return;
+        }
+
+        heap->_flushRanks();
+        if (!heap->forest)
+        {
+            return;
+        }
+
+        if (heap->pool != pool)
+        {
+            if (heap->pool.use_count() == 1)
+            {
+                pool->splice(*heap->pool);
+            }
+            else
+            {
+                pool->retain(heap->pool);
+            }
+        }
+
+        values.merge(heap->values);
+
+        statistics.comparison();
+        if (!minPtr || compare(heap->minPtr->key, minPtr->key))
         {
-            minPtr = other->getMinPtr();
+            minPtr = heap->minPtr;
         }
 
-        _insertForest(other->getForest());
-        other->getForest() = NULL;
+        _insertForest(heap->forest);
+        count += heap->count;
+
+        // consolidate all trees of heap, which deletions would scan otherwise
+        if (budget)
+        {
+            _consolidate(count);
+        }
+
+        heap->_init();
+    }
+
+    /**
+     * @brief Sets the number of roots consolidated per operation.
+     *
+     * By default, the budget is 0 and deleting the minimum consolidates the 
+     * whole forest at once. With a positive budget, the rank table is kept 
+     * between operations: every insertion and every decrease of a key moves 
+     * up to `budget` roots of the forest into it, linking roots of equal 
+     * rank. Deleting the minimum moves `budget` roots as well as the children 
+     * of the deleted node and determines the new minimum among the rank 
+     * table and the remaining roots of the forest.
+     *
+     * As long as the budget covers the roots created per operation, e.g. 2 
+     * for cascading cuts, the forest stays short and deletions take 
+     * logarithmic time in the worst case. Setting a positive budget 
+     * consolidates all roots of the forest at once, setting the budget to 0 
+     * moves all consolidated roots back into the forest.
+     * 
+     * Runtime: \f$ O(t + \log n) \f$ for \f$ t \f$ roots in the forest
+     *
+     * @param budget Number of roots to consolidate per operation, 0 for 
+     * amortized consolidation
+     */
+    void setBudget(int budget);
+
+    /**
+     * @brief Gets the number of roots consolidated per operation.
+     * 
+     * @return The work budget, 0 for amortized consolidation
+     */
+    int getBudget()
+    {
+        return budget;
+    }
+
+    /**
+     * @brief Writes a snapshot of the fibonacci heap to a file.
+     *
+     * The snapshot preserves the shape of all trees, ranks and marks. Nodes 
+     * are numbered breadth-first, one list of siblings after another, and 
+     * refer to each other by these numbers, see `SnapshotNode`. Values and 
+     * keys must be trivially copyable.
+     * 
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param path Path of the file to write
+     * @return true if the snapshot was written, false otherwise
+     */
+    bool save(const char* path);
+
+    /**
+     * @brief Replaces all nodes of the fibonacci heap by a snapshot file.
+     *
+     * The file is mapped into memory and all nodes are constructed within 
+     * one contiguous slab in a single pass. Trees keep their shape, hence 
+     * the heap is not consolidated. If the file is no valid snapshot of a 
+     * fibonacci heap with the same value and key types, the heap is left 
+     * unchanged.
+     * 
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param path Path of the file to read
+     * @param handles Vector the pointers to the loaded nodes are appended to, 
+     * in the order of the file
+     * @return true if the snapshot was loaded, false otherwise
+     */
+    bool load(const char* path, std::vector<FNode<V, K, Layout>*>& handles)
+    {
+        return _load(path, &handles);
+    }
+
+    /**
+     * @brief Replaces all nodes of the fibonacci heap by a snapshot file, 
+     * discarding the handles of the loaded nodes.
+     * 
+     * @param path Path of the file to read
+     * @return true if the snapshot was loaded, false otherwise
+     */
+    bool load(const char* path)
+    {
+        return _load(path, 
+            static_cast<std::vector<FNode<V, K, Layout>*>*>(NULL));
     }
 
     /**
      * @brief Gets the forest of trees.
+     *
+     * Roots consolidated with a work budget are moved back into the forest 
+     * first, such that it contains all trees.
      * 
      * @return A pointer to the first tree in the forest.
      */
-    FNode<V, K>* getForest()
+    FNode<V, K, Layout>* getForest()
     {
+        _flushRanks();
+
         return forest;
     }
 
@@ -330,35 +758,103 @@ public:
      * 
      * @return A pointer to the smallest element
      */
-    FNode<V, K>* getMinPtr()
+    FNode<V, K, Layout>* getMinPtr()
     {
         return minPtr;
     }
 
+    /**
+     * @brief Gets the operation counters of the heap.
+     *
+     * Counters are only maintained if the heap is instantiated with 
+     * `CountingStats`.
+     * 
+     * @return The instrumentation policy of the heap
+     */
+    const Stats& stats()
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief Resets the operation counters of the heap.
+     * 
+     */
+    void resetStats()
+    {
+        statistics.reset();
+    }
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     * 
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<FNode<V, K, Layout>>> getPool()
+    {
+        return pool;
+    }
+
 private:
     void _init();
 
-    void _deleteAll(FNode<V, K>* handle);
+    void _deleteAll(FNode<V, K, Layout>* handle);
 
-    FNode<V, K>* _singleton(V element, K key);
+    void _free(FNode<V, K, Layout>* handle);
 
-    void _newTree(FNode<V, K>* handle);
+    template<class... Args>
+    FNode<V, K, Layout>* _singleton(K key, Args&&... args);
 
-    void _cut(FNode<V, K>* handle);
+    void _newTree(FNode<V, K, Layout>* handle);
 
-    void _link(FNode<V, K>* a, FNode<V, K>* b);
+    void _buildForest(std::vector<FNode<V, K, Layout>*>& nodes);
 
-    void _cascadingCut(FNode<V, K>* handle);
+    void _cut(FNode<V, K, Layout>* handle);
+
+    void _link(FNode<V, K, Layout>* a, FNode<V, K, Layout>* b);
+
+    void _cascadingCut(FNode<V, K, Layout>* handle);
 
     void _unionByRank();
 
-    void _insertByRank(std::vector<FNode<V, K>*>& ranks, FNode<V, K>* handle);
+    void _insertByRank(FNode<V, K, Layout>* handle);
+
+    bool _unrank(FNode<V, K, Layout>* handle);
 
-    void _deleteMin();
+    void _flushRanks();
 
-    void _decreaseKey(FNode<V, K>* handle, K key);
+    void _consolidate(int roots);
 
-    void _insertForest(FNode<V, K>* other);
+    void _findMin();
+
+    void _removeRoot(FNode<V, K, Layout>* handle);
+
+    void _deleteRoot(FNode<V, K, Layout>* handle);
+
+    void _decreaseKey(FNode<V, K, Layout>* handle, K key);
+
+    void _insertForest(FNode<V, K, Layout>* other);
+
+    void _snapshotList(FNode<V, K, Layout>* first, std::uint32_t parent, 
+        std::vector<SnapshotNode<V, K>>& nodes, 
+        std::vector<FNode<V, K, Layout>*>& order);
+
+    bool _load(const char* path, std::vector<FNode<V, K, Layout>*>* handles);
+
+    template<class ValueIterator, class KeyIterator>
+    void _insertBatch(ValueIterator first, ValueIterator last, 
+        KeyIterator keys, std::vector<FNode<V, K, Layout>*>* handles);
+
+    // orders nodes by descending keys for the auxiliary heap
+    struct Greater
+    {
+        Compare compare;
+
+        bool operator()(FNode<V, K, Layout>* a, FNode<V, K, Layout>* b)
+        {
+            return compare(b->key, a->key);
+        }
+    };
 };
 
 #include "FibonacciHeap.hpp"
\ No newline at end of file
@@ -1,69 +1,121 @@
-template<class V, class K>
-void FibonacciHeap<V, K>::_init()
+template<class V, class K, class Compare, class Stats, class Layout>
+const int FibonacciHeap<V, K, Compare, Stats, Layout>::RANKS;
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_init()
 {
     forest = NULL;
     minPtr = NULL;
     count = 0;
+
+    for (int i = 0; i < RANKS; ++i)
+    {
+        ranks[i] = NULL;
+    }
+    occupied = 0;
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_deleteAll(FNode<V, K>* handle)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_deleteAll(
+    FNode<V, K, Layout>* handle)
 {
     if (handle)
     {
-        FNode<V, K>* current = handle;
-        do 
+        // open the circular list to terminate the traversal
+        handle->left->right = NULL;
+
+        FNode<V, K, Layout>* current = handle;
+        while (current)
         {
-            FNode<V, K>* node = current;
+            // splice children into the list behind the current node
+            if (current->child)
+            {
+                FNode<V, K, Layout>* first = current->child;
+                FNode<V, K, Layout>* last = first->left;
+                last->right = current->right;
+                current->right = first;
+            }
+
+            FNode<V, K, Layout>* node = current;
             current = current->right;
-            _deleteAll(node->child);
-            delete node;
+            _free(node);
         }
-        while (current != handle);
     }
 }
 
-template<class V, class K>
-FNode<V, K>* FibonacciHeap<V, K>::_singleton(V element, K key)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_free(
+    FNode<V, K, Layout>* handle)
+{
+    values.destroy(handle->value);
+    handle->~FNode<V, K, Layout>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+template<class... Args>
+FNode<V, K, Layout>* FibonacciHeap<V, K, Compare, Stats, Layout>::_singleton(
+    K key, Args&&... args)
 {
-    FNode<V, K>* node = new FNode<V, K>;
+    FNode<V, K, Layout>* node = new (pool->allocate()) 
+        FNode<V, K, Layout>(std::move(key), values, 
+            std::forward<Args>(args)...);
 
     node->parent = NULL;
     node->left = node;
     node->right = node;
     node->child = NULL;
 
-    node->value = element;
-    node->key = key;
-
     node->rank = 0;
     node->marked = false;
 
     return node;
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_newTree(FNode<V, K>* handle)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_newTree(
+    FNode<V, K, Layout>* handle)
 {
-    FNode<V, K>* end = forest->left;
-    forest->left = handle;
-    handle->left = end;
-    handle->right = forest;
-    end->right = handle;
+    if (!forest)
+    {
+        handle->left = handle;
+        handle->right = handle;
+        forest = handle;
+    }
+    else
+    {
+        FNode<V, K, Layout>* end = forest->left;
+        forest->left = handle;
+        handle->left = end;
+        handle->right = forest;
+        end->right = handle;
+    }
+
+    // with a work budget, the minimum may be a root of the rank table
+    if (!minPtr)
+    {
+        minPtr = handle;
+
+        return;
+    }
 
-    if (handle->key < minPtr->key)
+    statistics.comparison();
+    if (compare(handle->key, minPtr->key))
     {
         minPtr = handle;
     }
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_cut(FNode<V, K>* handle)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_cut(
+    FNode<V, K, Layout>* handle)
 {
+    FNode<V, K, Layout>* parent = handle->parent;
+
     // advance child pointer of parent
-    if (handle->parent->child == handle)
+    if (parent->child == handle)
     {
-        handle->parent->child == handle->right;
+        parent->child = (handle->right != handle) ? handle->right : NULL;
     }
 
     // remove subtree rooted at handle
@@ -73,13 +125,24 @@ void FibonacciHeap<V, K>::_cut(FNode<V, K>* handle)
     handle->right = handle;
 
     handle->parent = NULL;
+    handle->marked = false;
+
+    // a consolidated root changes its rank, hence it is pending again
+    if (!parent->parent && _unrank(parent))
+    {
+        _insertForest(parent);
+    }
+    (parent->rank)--;
+
+    statistics.cut();
 
     // insert handle as new tree
     _newTree(handle);
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_link(FNode<V, K>* a, FNode<V, K>* b)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_link(
+    FNode<V, K, Layout>* a, FNode<V, K, Layout>* b)
 {
     b->left->right = b->right;
     b->right->left = b->left;
@@ -101,107 +164,257 @@ void FibonacciHeap<V, K>::_link(FNode<V, K>* a, FNode<V, K>* b)
     }
 
     b->parent = a;
+    b->marked = false;
 
     // increment rank of surviving root
     (a->rank)++;
+
+    statistics.link();
+    statistics.rank(a->rank);
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_cascadingCut(FNode<V, K>* handle)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_cascadingCut(
+    FNode<V, K, Layout>* handle)
 {
     // cut if handle is not a root
     if (handle->parent)
     {
-        FNode<V, K>* parent = handle-> parent;
-        handle->marked = false;
+        FNode<V, K, Layout>* parent = handle->parent;
 
         _cut(handle);
 
-        // cascading cuts
-        if (parent->marked)
+        // cascading cuts, roots are never marked
+        if (parent->parent)
         {
-            _cascadingCut(parent);
-        }
-        else
-        {
-            parent->marked = true;
+            if (parent->marked)
+            {
+                statistics.cascadingCut();
+                _cascadingCut(parent);
+            }
+            else
+            {
+                parent->marked = true;
+            }
         }
     }
-    else 
+    else
     {
         // update min pointer
-        if (handle->key < minPtr->key)
+        statistics.comparison();
+        if (compare(handle->key, minPtr->key))
         {
             minPtr = handle;
         }
     }
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_unionByRank()
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_unionByRank()
 {
-    std::vector<FNode<V, K>> ranks(count, NULL);
+    // detach every tree from the forest and insert it by rank
+    FNode<V, K, Layout>* current = forest;
+    forest->left->right = NULL;
+    forest = NULL;
+    minPtr = NULL;
 
-    FNode<V, K>* it = forest;
-    do
+    std::uint64_t trees = 0;
+    while (current)
     {
-        _insertByRank(ranks, it);
+        FNode<V, K, Layout>* node = current;
+        current = current->right;
+
+        node->left = node;
+        node->right = node;
+
+        _insertByRank(node);
+        ++trees;
+    }
+
+    statistics.consolidation(trees);
+
+    // rebuild the forest from the surviving roots and empty the rank table
+    while (occupied)
+    {
+        int rank = lowestBit(occupied);
+        occupied &= occupied - 1;
+
+        _newTree(ranks[rank]);
+        ranks[rank] = NULL;
     }
-    while (it != forest);
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_insertByRank(
-    std::vector<FNode<V, K>*>& ranks, FNode<V, K>* handle)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_insertByRank(
+    FNode<V, K, Layout>* handle)
 {
-    /*
-     * if there is a collision, 
-     *  1. link nodes with same rank
-     *  2. insert surviving root recursively
-     */
-    FNode<V, K>* collision = ranks[handle->rank];
-    if (collision)
+    // link trees of equal rank until the rank of the survivor is free
+    while (true)
     {
-        if (handle->key < collision->key)
+        int rank = handle->rank;
+        assert(rank < RANKS);
+
+        FNode<V, K, Layout>* collision = ranks[rank];
+        if (!collision)
+        {
+            ranks[rank] = handle;
+            occupied |= std::uint64_t(1) << rank;
+
+            return;
+        }
+
+        ranks[rank] = NULL;
+        occupied &= ~(std::uint64_t(1) << rank);
+
+        statistics.comparison();
+        if (compare(handle->key, collision->key))
         {
             _link(handle, collision);
-            _insertByRank(handle);
         }
         else
         {
             _link(collision, handle);
-            _insertByRank(collision);
+            handle = collision;
         }
     }
-    else
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+bool FibonacciHeap<V, K, Compare, Stats, Layout>::_unrank(
+    FNode<V, K, Layout>* handle)
+{
+    if (ranks[handle->rank] != handle)
+    {
+        return false;
+    }
+
+    ranks[handle->rank] = NULL;
+    occupied &= ~(std::uint64_t(1) << handle->rank);
+
+    return true;
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_flushRanks()
+{
+    while (occupied)
+    {
+        int rank = lowestBit(occupied);
+        occupied &= occupied - 1;
+
+        _insertForest(ranks[rank]);
+        ranks[rank] = NULL;
+    }
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_consolidate(int roots)
+{
+    // move roots from the front of the forest into the rank table
+    std::uint64_t trees = 0;
+    while (roots > 0 && forest)
+    {
+        FNode<V, K, Layout>* node = forest;
+        _removeRoot(node);
+        _insertByRank(node);
+
+        --roots;
+        ++trees;
+    }
+
+    if (trees)
+    {
+        statistics.consolidation(trees);
+    }
+
+    // ties may link the minimum below a root of equal key
+    while (minPtr && minPtr->parent)
+    {
+        minPtr = minPtr->parent;
+    }
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_findMin()
+{
+    minPtr = NULL;
+
+    if (forest)
+    {
+        FNode<V, K, Layout>* node = forest;
+        do
+        {
+            statistics.comparison();
+            if (!minPtr || compare(node->key, minPtr->key))
+            {
+                minPtr = node;
+            }
+            node = node->right;
+        }
+        while (node != forest);
+    }
+
+    for (std::uint64_t bits = occupied; bits; bits &= bits - 1)
     {
-         ranks[handle->rank] = handle;
+        FNode<V, K, Layout>* node = ranks[lowestBit(bits)];
+
+        statistics.comparison();
+        if (!minPtr || compare(node->key, minPtr->key))
+        {
+            minPtr = node;
+        }
     }
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_deleteMin()
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::setBudget(int budget)
 {
-    auto handle = minPtr;
+    assert(budget >= 0);
 
-    // connect siblings
-    if (handle->left == handle || handle->right == handle)
+    /*
+     * amortized consolidation expects all roots within the forest, whereas 
+     * deletions with a budget scan every root left in the forest
+     */
+    if (!budget)
     {
-        handle->left = NULL;
-        handle->right = NULL;
+        _flushRanks();
     }
     else
     {
-        handle->left->right = handle->right;
-        handle->right->left = handle->left;
+        _consolidate(count);
     }
 
-    // connect parent to next child
-    if (handle->parent)
+    this->budget = budget;
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_removeRoot(
+    FNode<V, K, Layout>* handle)
+{
+    if (handle->right == handle)
     {
-        handle->parent->child = handle->right;
-        handle->parent = NULL;
+        forest = NULL;
     }
+    else
+    {
+        handle->left->right = handle->right;
+        handle->right->left = handle->left;
+
+        if (forest == handle)
+        {
+            forest = handle->right;
+        }
+    }
+
+    handle->left = handle;
+    handle->right = handle;
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_deleteRoot(
+    FNode<V, K, Layout>* handle)
+{
+    int children = handle->rank;
 
     // add children as new trees
     if (handle->child)
@@ -209,32 +422,404 @@ void FibonacciHeap<V, K>::_deleteMin()
         auto current = handle->child;
         do
         {
-            auto node = current;
+            current->parent = NULL;
+            current->marked = false;
             current = current->right;
-
-            _newTree(node);
         }
         while (current != handle->child);
+
+        _insertForest(handle->child);
+        handle->child = NULL;
+    }
+
+    if (!_unrank(handle))
+    {
+        _removeRoot(handle);
     }
+    _free(handle);
+
+    --count;
+    minPtr = NULL;
 
-    _unionByRank();
+    if (budget)
+    {
+        _consolidate(budget + children);
+        _findMin();
+    }
+    else if (forest)
+    {
+        _unionByRank();
+    }
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_decreaseKey(FNode<V, K>* handle, K key)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_decreaseKey(
+    FNode<V, K, Layout>* handle, K key)
 {
     handle->key = key;
 
-    _cascadingCut(handle);
+    // cut only if heap order is violated
+    statistics.comparison();
+    if (handle->parent && compare(key, handle->parent->key))
+    {
+        _cascadingCut(handle);
+    }
+    else if (!handle->parent && compare(key, minPtr->key))
+    {
+        minPtr = handle;
+    }
 }
 
-template<class V, class K>
-void FibonacciHeap<V, K>::_insertForest(FNode<V, K>* other)
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_insertForest(
+    FNode<V, K, Layout>* other)
 {
+    if (!other)
+    {
+        return;
+    }
+
+    if (!forest)
+    {
+        forest = other;
+
+        return;
+    }
+
     // insert other forest into heap
-    FNode<V, K>* end = forest->left;
-    forest->left = other->left;
-    other->left->right = forest;
+    FNode<V, K, Layout>* end = forest->left;
+    FNode<V, K, Layout>* otherEnd = other->left;
+    forest->left = otherEnd;
+    otherEnd->right = forest;
     other->left = end;
     end->right = other;
-}
\ No newline at end of file
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_buildForest(
+    std::vector<FNode<V, K, Layout>*>& nodes)
+{
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    // link all nodes into one circular list and find their minimum
+    FNode<V, K, Layout>* min = nodes[0];
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        FNode<V, K, Layout>* node = nodes[i];
+
+        node->parent = NULL;
+        node->left = nodes[(i > 0) ? i - 1 : nodes.size() - 1];
+        node->right = nodes[(i + 1 < nodes.size()) ? i + 1 : 0];
+        node->child = NULL;
+
+        node->rank = 0;
+        node->marked = false;
+
+        statistics.comparison();
+        if (compare(node->key, min->key))
+        {
+            min = node;
+        }
+    }
+
+    statistics.comparison();
+    if (!minPtr || compare(min->key, minPtr->key))
+    {
+        minPtr = min;
+    }
+
+    _insertForest(nodes[0]);
+    count += static_cast<int>(nodes.size());
+
+    if (budget)
+    {
+        _consolidate(static_cast<int>(nodes.size()));
+    }
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+int FibonacciHeap<V, K, Compare, Stats, Layout>::deleteMinBatch(
+    int k, std::vector<V>& out)
+{
+    _flushRanks();
+
+    if (k <= 0 || !forest)
+    {
+        return 0;
+    }
+
+    // move all roots into the auxiliary heap
+    candidates.clear();
+
+    FNode<V, K, Layout>* current = forest;
+    forest->left->right = NULL;
+    while (current)
+    {
+        candidates.push_back(current);
+        current = current->right;
+    }
+
+    forest = NULL;
+    minPtr = NULL;
+
+    Greater greater = { compare };
+    std::make_heap(candidates.begin(), candidates.end(), greater);
+
+    int deleted = 0;
+    while (deleted < k && !candidates.empty())
+    {
+        std::pop_heap(candidates.begin(), candidates.end(), greater);
+        FNode<V, K, Layout>* handle = candidates.back();
+        candidates.pop_back();
+
+        // children become candidates
+        if (handle->child)
+        {
+            FNode<V, K, Layout>* child = handle->child;
+            FNode<V, K, Layout>* node = child;
+            do
+            {
+                node->parent = NULL;
+                node->marked = false;
+                candidates.push_back(node);
+                std::push_heap(candidates.begin(), candidates.end(), greater);
+
+                node = node->right;
+            }
+            while (node != child);
+        }
+
+        out.push_back(std::move(handle->value.get()));
+        _free(handle);
+        ++deleted;
+    }
+
+    count -= deleted;
+
+    // remaining candidates form the new forest
+    for (std::size_t i = 0; i < candidates.size(); ++i)
+    {
+        _newTree(candidates[i]);
+    }
+    candidates.clear();
+
+    if (forest)
+    {
+        _unionByRank();
+    }
+
+    return deleted;
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+template<class ValueIterator, class KeyIterator>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_insertBatch(
+    ValueIterator first, ValueIterator last,
+    KeyIterator keys, std::vector<FNode<V, K, Layout>*>* handles)
+{
+    FNode<V, K, Layout>* ring = NULL;
+    FNode<V, K, Layout>* min = NULL;
+    int n = 0;
+
+    for (; first != last; ++first, ++keys)
+    {
+        FNode<V, K, Layout>* node = new (pool->allocate()) 
+            FNode<V, K, Layout>(*keys, values, *first);
+
+        node->parent = NULL;
+        node->child = NULL;
+
+        node->rank = 0;
+        node->marked = false;
+
+        // append to the circular list of the batch
+        if (ring)
+        {
+            FNode<V, K, Layout>* end = ring->left;
+            end->right = node;
+            node->left = end;
+            node->right = ring;
+            ring->left = node;
+        }
+        else
+        {
+            node->left = node;
+            node->right = node;
+            ring = node;
+        }
+
+        statistics.comparison();
+        if (!min || compare(node->key, min->key))
+        {
+            min = node;
+        }
+
+        if (handles)
+        {
+            handles->push_back(node);
+        }
+        ++n;
+    }
+
+    if (!ring)
+    {
+        return;
+    }
+
+    statistics.comparison();
+    if (!minPtr || compare(min->key, minPtr->key))
+    {
+        minPtr = min;
+    }
+
+    _insertForest(ring);
+    count += n;
+
+    if (budget)
+    {
+        _consolidate(n);
+    }
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+bool FibonacciHeap<V, K, Compare, Stats, Layout>::save(const char* path)
+{
+    _flushRanks();
+
+    if (static_cast<std::uint64_t>(count) >= Snapshot::NIL)
+    {
+        return false;
+    }
+
+    std::vector<SnapshotNode<V, K>> nodes;
+    std::vector<FNode<V, K, Layout>*> order;
+    nodes.reserve(count);
+    order.reserve(count);
+
+    std::uint32_t min = Snapshot::NIL;
+    if (forest)
+    {
+        _snapshotList(forest, Snapshot::NIL, nodes, order);
+
+        // the minimum is a root, hence among the nodes numbered so far
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (order[i] == minPtr)
+            {
+                min = static_cast<std::uint32_t>(i);
+            }
+        }
+
+        // append the children of every node, breadth-first
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (order[i]->child)
+            {
+                nodes[i].child = static_cast<std::uint32_t>(order.size());
+                _snapshotList(order[i]->child, static_cast<std::uint32_t>(i), 
+                    nodes, order);
+            }
+        }
+    }
+
+    return Snapshot::write(path, Snapshot::FIBONACCI, nodes, 
+        forest ? 0 : Snapshot::NIL, min);
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+void FibonacciHeap<V, K, Compare, Stats, Layout>::_snapshotList(
+    FNode<V, K, Layout>* first, std::uint32_t parent, 
+    std::vector<SnapshotNode<V, K>>& nodes, 
+    std::vector<FNode<V, K, Layout>*>& order)
+{
+    std::uint32_t begin = static_cast<std::uint32_t>(order.size());
+
+    FNode<V, K, Layout>* node = first;
+    do
+    {
+        SnapshotNode<V, K> record;
+        std::memset(&record, 0, sizeof(record));
+
+        record.parent = parent;
+        record.child = Snapshot::NIL;
+        record.rank = node->rank;
+        record.marked = node->marked;
+        record.value = node->value.get();
+        record.key = node->key;
+
+        nodes.push_back(record);
+        order.push_back(node);
+
+        node = node->right;
+    }
+    while (node != first);
+
+    // siblings are consecutive, closing the circular list at both ends
+    std::uint32_t end = static_cast<std::uint32_t>(order.size());
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        nodes[i].left = (i == begin) ? end - 1 : i - 1;
+        nodes[i].right = (i + 1 == end) ? begin : i + 1;
+    }
+}
+
+template<class V, class K, class Compare, class Stats, class Layout>
+bool FibonacciHeap<V, K, Compare, Stats, Layout>::_load(const char* path, 
+    std::vector<FNode<V, K, Layout>*>* handles)
+{
+    SnapshotFile file(path);
+
+    const SnapshotNode<V, K>* records = 
+        file.nodes<V, K>(Snapshot::FIBONACCI);
+    if (!records)
+    {
+        return false;
+    }
+
+    clear();
+
+    const SnapshotHeader* header = file.header();
+    std::uint32_t n = static_cast<std::uint32_t>(header->count);
+
+    std::vector<FNode<V, K, Layout>*> nodes;
+    pool->allocateBulk(n, nodes);
+
+    for (std::uint32_t i = 0; i < n; ++i)
+    {
+        const SnapshotNode<V, K>& record = records[i];
+
+        FNode<V, K, Layout>* node = new (nodes[i]) 
+            FNode<V, K, Layout>(record.key, values, record.value);
+
+        node->parent = (record.parent != Snapshot::NIL) 
+            ? nodes[record.parent] : NULL;
+        node->left = nodes[record.left];
+        node->right = nodes[record.right];
+        node->child = (record.child != Snapshot::NIL) 
+            ? nodes[record.child] : NULL;
+        node->rank = record.rank;
+        node->marked = record.marked;
+    }
+
+    if (n > 0)
+    {
+        forest = nodes[header->forest];
+        minPtr = nodes[header->minPtr];
+        count = static_cast<int>(n);
+    }
+
+    if (budget)
+    {
+        _consolidate(count);
+    }
+
+    if (handles)
+    {
+        handles->insert(handles->end(), nodes.begin(), nodes.end());
+    }
+
+    return true;
+}
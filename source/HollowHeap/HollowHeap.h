@@ -0,0 +1,465 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../util/Bits.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+template<class V, class K> class HollowHeap;
+
+template<class V, class K> struct HNode;
+
+/**
+ * @brief Template for items of a hollow heap.
+ *
+ * Items are the handles of a hollow heap. They store some value of type `V`
+ * and point to the node currently holding them. Decreasing the key moves an
+ * item to a new node, hence items rather than nodes are returned by
+ * `insert`, such that handles remain valid until the element is deleted.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct HItem : public INode<V, K>
+{
+public:
+    friend class HollowHeap<V, K>;
+
+    /**
+     * @brief Gets the value of the item.
+     *
+     * @return The value stored in the item
+     */
+    V getValue()
+    {
+        return value;
+    }
+
+    /**
+     * @brief Gets the key associated with the item.
+     *
+     * @return The key of the node holding the item
+     */
+    K getKey();
+
+    /**
+     * @brief Gets the node currently holding the item.
+     *
+     * @return A pointer to the node of the item
+     */
+    HNode<V, K>* getNode()
+    {
+        return node;
+    }
+
+private:
+    HNode<V, K>* node;
+
+    V value;
+};
+
+/**
+ * @brief Template for nodes of a hollow heap.
+ *
+ * Hollow heap nodes maintain a pointer to their first child and to their
+ * next sibling. A node that lost its item is hollow and may have a second
+ * parent, such that the nodes of a hollow heap form a directed acyclic
+ * graph.
+ *
+ * They are associated with a key of type `K` and hold an item or none.
+ * Furthermore, they maintain a rank.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct HNode
+{
+public:
+    friend class HollowHeap<V, K>;
+
+    /**
+     * @brief Gets the item held by the node.
+     *
+     * @return A pointer to the item, or `NULL` if the node is hollow
+     */
+    HItem<V, K>* getItem()
+    {
+        return item;
+    }
+
+    /**
+     * @brief Gets the first child node.
+     *
+     * @return A pointer to the first child node
+     */
+    HNode<V, K>* getChild()
+    {
+        return child;
+    }
+
+    /**
+     * @brief Gets the next sibling node.
+     *
+     * @return A pointer to the next sibling node
+     */
+    HNode<V, K>* getNext()
+    {
+        return next;
+    }
+
+    /**
+     * @brief Gets the key associated with the heap node.
+     *
+     * @return The key associated with the heap node
+     */
+    K getKey()
+    {
+        return key;
+    }
+
+    /**
+     * @brief Get the rank associated with the heap node.
+     *
+     * @return The rank of the heap node.
+     */
+    int getRank()
+    {
+        return rank;
+    }
+
+    bool isHollow()
+    {
+        return !item;
+    }
+
+    bool hasChildren()
+    {
+        return child;
+    }
+
+private:
+    HItem<V, K>* item;
+
+    HNode* child;
+    HNode* next;
+    HNode* secondParent;
+
+    K key;
+    int rank;
+};
+
+template<class V, class K>
+K HItem<V, K>::getKey()
+{
+    return node->getKey();
+}
+
+/**
+ * @brief Template for hollow heap data structures.
+ *
+ * Hollow heaps, as proposed by Hansen, Kaplan, Tarjan and Zwick, maintain a
+ * single heap-ordered tree whose root holds the minimum. Decreasing a key
+ * does not cut any subtree: the item moves to a new node, which adopts the
+ * old node as its child, and the old node becomes hollow. Deleting an item
+ * other than the minimum merely hollows its node.
+ *
+ * Hollow nodes are destroyed when they become roots while deleting the
+ * minimum. Their children are linked by rank in a single pass, as in
+ * Fibonacci heaps.
+ *
+ * This results in amortized logarithmic time for deletions and constant time
+ * for every other operation, with less pointer surgery than cutting trees.
+ * Items and nodes are allocated from separate node pools.
+ *
+ * All operations are statically dispatched. Use `HeapAdapter` to access the
+ * heap through `IHeap`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+class HollowHeap
+: public HeapBase<HollowHeap<V, K>, V, K, HItem<V, K>*>
+{
+private:
+    /*
+     * a node of rank r has at least phi^r descendants including hollow ones,
+     * hence a rank table indexed by a 64 bit mask can never overflow
+     */
+    static const int RANKS = std::numeric_limits<std::uint64_t>::digits;
+
+    HNode<V, K>* root;
+    int count;
+
+    // rank table of _deleteHollowRoot, empty between deletions
+    HNode<V, K>* ranks[RANKS];
+    std::uint64_t occupied;
+
+    std::shared_ptr<NodePool<HNode<V, K>>> pool;
+    std::shared_ptr<NodePool<HItem<V, K>>> items;
+
+public:
+    /**
+     * @brief Constructs a new hollow heap with its own node pools.
+     *
+     */
+    HollowHeap()
+    : pool(std::make_shared<NodePool<HNode<V, K>>>()),
+      items(std::make_shared<NodePool<HItem<V, K>>>())
+    {
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new hollow heap allocating from given pools.
+     *
+     * Heaps that are going to be merged should share both pools, such that
+     * merging does not need to transfer or retain any slabs.
+     *
+     * @param pool The node pool to allocate nodes from
+     * @param items The node pool to allocate items from
+     */
+    HollowHeap(std::shared_ptr<NodePool<HNode<V, K>>> pool,
+        std::shared_ptr<NodePool<HItem<V, K>>> items)
+    : pool(pool), items(items)
+    {
+        assert(pool);
+        assert(items);
+
+        _init();
+    }
+
+    HollowHeap(const HollowHeap&) = delete;
+    HollowHeap& operator=(const HollowHeap&) = delete;
+
+    /**
+     * @brief Destroys the hollow heap and all of its nodes and items.
+     *
+     */
+    ~HollowHeap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes and items of the hollow heap.
+     *
+     * If the heap is the only user of both pools and nodes as well as items
+     * are trivially destructible, all slabs are released at once. Otherwise,
+     * every node and item is destroyed and returned to its pool separately.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(N) \f$ for \f$ N \f$ nodes, respectively
+     */
+    void clear()
+    {
+        if (pool.use_count() == 1 && items.use_count() == 1
+            && std::is_trivially_destructible<HNode<V, K>>::value
+            && std::is_trivially_destructible<HItem<V, K>>::value)
+        {
+            pool->release();
+            items->release();
+        }
+        else if (root)
+        {
+            _deleteAll();
+        }
+
+        _init();
+    }
+
+    /**
+     * @brief Reserves space for a number of elements.
+     *
+     * Neither the node pool nor the item pool grow until more than `n`
+     * elements are in the heap. Decreasing a key moves the item to a new node
+     * and leaves a hollow node behind, which takes up a node of the pool
+     * until it is deleted.
+     *
+     * @param n Number of elements to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        pool->reserve(n);
+        items->reserve(n);
+    }
+
+    /**
+     * @brief Determines the current size of the hollow heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current number of items in the heap
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the hollow heap.
+     *
+     * The new node is linked with the root.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return A pointer to the item of the element
+     */
+    HItem<V, K>* insert(V element, K key)
+    {
+        HItem<V, K>* item = new (items->allocate()) HItem<V, K>;
+        item->value = element;
+
+        HNode<V, K>* node = _makeNode(item, key);
+        root = root ? _link(node, root) : node;
+
+        ++count;
+
+        return item;
+    }
+
+    /**
+     * @brief Determines the value of the item with the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return Value of the smallest element
+     */
+    V min()
+    {
+        assert(count > 0);
+
+        return root->item->value;
+    }
+
+    /**
+     * @brief Deletes the item with smallest key and returns its value.
+     *
+     * Runtime: \f$ O(\log N) \f$ amortized for \f$ N \f$ nodes
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(count > 0);
+
+        return remove(root->item);
+    }
+
+    /**
+     * @brief Removes a given item from the hollow heap.
+     *
+     * The node of the item becomes hollow. Only if it is the root, hollow
+     * roots are destroyed and their children linked by rank.
+     *
+     * Runtime: \f$ O(1) \f$, or \f$ O(\log N) \f$ amortized for the root
+     *
+     * @param handle Pointer to the item to remove
+     * @return Value of the deleted element
+     */
+    V remove(HItem<V, K>* handle)
+    {
+        V value = handle->value;
+
+        handle->node->item = NULL;
+        _freeItem(handle);
+        --count;
+
+        if (!root->item)
+        {
+            _deleteHollowRoot();
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Decreases the key of a given item.
+     *
+     * Unless the item is held by the root, it moves to a new node which
+     * adopts the old, now hollow node as its child and is linked with the
+     * root. The handle remains valid.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param handle Pointer to the item
+     * @param key New key value of the item
+     */
+    void decreaseKey(HItem<V, K>* handle, K key);
+
+    /**
+     * @brief Merges two instances of hollow heaps.
+     *
+     * Both roots are linked and `heap` is left empty. Node pools are
+     * transferred or retained as for the other heaps.
+     *
+     * Runtime: \f$ O(1) \f$ for shared pools
+     *
+     * @param heap Pointer to the hollow heap to merge with
+     */
+    void merge(HollowHeap<V, K>* heap);
+
+    /**
+     * @brief Gets the root of the heap.
+     *
+     * @return A pointer to the node holding the smallest element
+     */
+    HNode<V, K>* getRoot()
+    {
+        return root;
+    }
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     *
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<HNode<V, K>>> getPool()
+    {
+        return pool;
+    }
+
+    /**
+     * @brief Gets the node pool the heap allocates its items from.
+     *
+     * @return A shared pointer to the item pool
+     */
+    std::shared_ptr<NodePool<HItem<V, K>>> getItemPool()
+    {
+        return items;
+    }
+
+private:
+    void _init();
+
+    void _deleteAll();
+
+    void _free(HNode<V, K>* handle);
+
+    void _freeItem(HItem<V, K>* handle);
+
+    HNode<V, K>* _makeNode(HItem<V, K>* item, K key);
+
+    HNode<V, K>* _link(HNode<V, K>* a, HNode<V, K>* b);
+
+    void _insertByRank(HNode<V, K>* handle);
+
+    void _deleteHollowRoot();
+
+    template<class T>
+    static void _transfer(std::shared_ptr<NodePool<T>>& to,
+        std::shared_ptr<NodePool<T>>& from);
+};
+
+#include "HollowHeap.hpp"
@@ -0,0 +1,268 @@
+template<class V, class K>
+const int HollowHeap<V, K>::RANKS;
+
+template<class V, class K>
+void HollowHeap<V, K>::_init()
+{
+    root = NULL;
+    count = 0;
+
+    for (int i = 0; i < RANKS; ++i)
+    {
+        ranks[i] = NULL;
+    }
+    occupied = 0;
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::_deleteAll()
+{
+    HNode<V, K>* list = root;
+    root->next = NULL;
+
+    while (list)
+    {
+        HNode<V, K>* node = list;
+        list = list->next;
+
+        /*
+         * children with a second parent are kept until their other parent
+         * is destroyed, the others are destroyed in turn
+         */
+        HNode<V, K>* current = node->child;
+        while (current)
+        {
+            HNode<V, K>* child = current;
+            current = current->next;
+
+            if (!child->secondParent)
+            {
+                child->next = list;
+                list = child;
+            }
+            else
+            {
+                if (child->secondParent == node)
+                {
+                    current = NULL;
+                }
+                else
+                {
+                    child->next = NULL;
+                }
+
+                child->secondParent = NULL;
+            }
+        }
+
+        if (node->item)
+        {
+            _freeItem(node->item);
+        }
+        _free(node);
+    }
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::_free(HNode<V, K>* handle)
+{
+    handle->~HNode<V, K>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::_freeItem(HItem<V, K>* handle)
+{
+    handle->~HItem<V, K>();
+    items->deallocate(handle);
+}
+
+template<class V, class K>
+HNode<V, K>* HollowHeap<V, K>::_makeNode(HItem<V, K>* item, K key)
+{
+    HNode<V, K>* node = new (pool->allocate()) HNode<V, K>;
+
+    node->item = item;
+    node->child = NULL;
+    node->next = NULL;
+    node->secondParent = NULL;
+
+    node->key = key;
+    node->rank = 0;
+
+    item->node = node;
+
+    return node;
+}
+
+template<class V, class K>
+HNode<V, K>* HollowHeap<V, K>::_link(HNode<V, K>* a, HNode<V, K>* b)
+{
+    // the node with larger key becomes the first child of the other
+    if (b->key < a->key)
+    {
+        a->next = b->child;
+        b->child = a;
+
+        return b;
+    }
+    else
+    {
+        b->next = a->child;
+        a->child = b;
+
+        return a;
+    }
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::decreaseKey(HItem<V, K>* handle, K key)
+{
+    HNode<V, K>* node = handle->node;
+    if (!(key < node->key))
+    {
+        return;
+    }
+
+    if (node == root)
+    {
+        node->key = key;
+
+        return;
+    }
+
+    // move the item to a new node which adopts the hollow node
+    HNode<V, K>* moved = _makeNode(handle, key);
+    node->item = NULL;
+
+    moved->rank = (node->rank > 2) ? node->rank - 2 : 0;
+    moved->child = node;
+    node->secondParent = moved;
+
+    root = _link(moved, root);
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::_insertByRank(HNode<V, K>* handle)
+{
+    // link trees of equal rank until the rank of the survivor is free
+    while (true)
+    {
+        int rank = handle->rank;
+        assert(rank < RANKS);
+
+        HNode<V, K>* collision = ranks[rank];
+        if (!collision)
+        {
+            ranks[rank] = handle;
+            occupied |= std::uint64_t(1) << rank;
+
+            return;
+        }
+
+        ranks[rank] = NULL;
+        occupied &= ~(std::uint64_t(1) << rank);
+
+        handle = _link(handle, collision);
+        ++(handle->rank);
+    }
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::_deleteHollowRoot()
+{
+    // list of hollow nodes to destroy, starting with the root
+    HNode<V, K>* list = root;
+    root->next = NULL;
+    root = NULL;
+
+    while (list)
+    {
+        HNode<V, K>* node = list;
+        list = list->next;
+
+        HNode<V, K>* current = node->child;
+        while (current)
+        {
+            HNode<V, K>* child = current;
+            current = current->next;
+
+            if (child->item)
+            {
+                // full children are linked by rank
+                _insertByRank(child);
+            }
+            else if (!child->secondParent)
+            {
+                // hollow children without another parent are destroyed
+                child->next = list;
+                list = child;
+            }
+            else
+            {
+                /*
+                 * hollow children with two parents lose one of them: as
+                 * last child of their second parent, the remaining siblings
+                 * belong to the first parent
+                 */
+                if (child->secondParent == node)
+                {
+                    current = NULL;
+                }
+                else
+                {
+                    child->next = NULL;
+                }
+
+                child->secondParent = NULL;
+            }
+        }
+
+        _free(node);
+    }
+
+    // link the remaining trees into the new root and empty the rank table
+    while (occupied)
+    {
+        int rank = lowestBit(occupied);
+        occupied &= occupied - 1;
+
+        root = root ? _link(ranks[rank], root) : ranks[rank];
+        ranks[rank] = NULL;
+    }
+}
+
+template<class V, class K>
+template<class T>
+void HollowHeap<V, K>::_transfer(std::shared_ptr<NodePool<T>>& to,
+    std::shared_ptr<NodePool<T>>& from)
+{
+    if (from != to)
+    {
+        if (from.use_count() == 1)
+        {
+            to->splice(*from);
+        }
+        else
+        {
+            to->retain(from);
+        }
+    }
+}
+
+template<class V, class K>
+void HollowHeap<V, K>::merge(HollowHeap<V, K>* heap)
+{
+    if (heap == this || !heap->root)
+    {
+        return;
+    }
+
+    _transfer(pool, heap->pool);
+    _transfer(items, heap->items);
+
+    root = root ? _link(heap->root, root) : heap->root;
+    count += heap->count;
+
+    heap->_init();
+}
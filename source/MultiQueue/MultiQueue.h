@@ -0,0 +1,163 @@
+#pragma once
+
+#include "../PairingHeap/PairingHeap.h"
+#include "../memory/AlignedAllocator.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Template for relaxed concurrent priority queues.
+ *
+ * MultiQueues distribute their elements over `c * p` pairing heaps (shards) 
+ * for `p` threads. Every shard is protected by its own lock which is only 
+ * ever acquired with `try_lock`, such that threads move on to another shard 
+ * instead of waiting.
+ *
+ * Insertions go to a random shard. Deletions sample two random shards and 
+ * delete the minimum of the shard with the smaller minimum. Hence, the 
+ * deleted element is not necessarily the smallest one, but its expected 
+ * rank is in \f$ O(c \cdot p) \f$.
+ *
+ * All public methods are thread-safe. Unlike the heaps of this project, 
+ * MultiQueues do not hand out handles.
+ * 
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for trivially copyable key types
+ */
+template<class V, class K>
+class MultiQueue
+{
+    static_assert(std::is_trivially_copyable<K>::value, 
+        "MultiQueue requires trivially copyable keys");
+
+private:
+    // aligned to keep neighbouring shards on separate cache lines
+    struct alignas(64) Shard
+    {
+        std::mutex mutex;
+        PairingHeap<V, K> heap;
+
+        // published under the lock, read without it
+        std::atomic<K> top;
+        std::atomic<int> count;
+
+        Shard()
+        : count(0)
+        {
+        }
+
+        // plain new does not respect the alignment before C++17
+        static void* operator new(std::size_t)
+        {
+            return AlignedAllocator<Shard>().allocate(1);
+        }
+
+        static void operator delete(void* pointer)
+        {
+            AlignedAllocator<Shard>().deallocate(
+                static_cast<Shard*>(pointer), 1);
+        }
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+
+public:
+    /**
+     * @brief Constructs a new MultiQueue for a number of threads.
+     * 
+     * @param threads Number of threads accessing the queue
+     * @param factor Number of shards per thread
+     */
+    explicit MultiQueue(int threads, int factor = 2)
+    {
+        assert(threads > 0);
+        assert(factor > 0);
+
+        for (int i = 0; i < threads * factor; ++i)
+        {
+            shards.push_back(std::unique_ptr<Shard>(new Shard));
+        }
+    }
+
+    MultiQueue(const MultiQueue&) = delete;
+    MultiQueue& operator=(const MultiQueue&) = delete;
+
+    /**
+     * @brief Determines the number of elements in the queue.
+     *
+     * The result is exact only if no other thread modifies the queue.
+     * 
+     * Runtime: \f$ O(c \cdot p) \f$
+     * 
+     * @return The current size of the queue
+     */
+    int size();
+
+    /**
+     * @brief Determines the number of shards.
+     * 
+     * @return The number of pairing heaps the elements are distributed over
+     */
+    int shardCount()
+    {
+        return static_cast<int>(shards.size());
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into a random shard.
+     * 
+     * Runtime: \f$ O(1) \f$ expected, if not contended
+     * 
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     */
+    void insert(V element, K key);
+
+    /**
+     * @brief Deletes an element with small key and returns its value.
+     *
+     * Samples two random shards and deletes the minimum of the one with the 
+     * smaller minimum. If sampling keeps failing, all shards are scanned 
+     * from a random one for the smallest published minimum, which is tried 
+     * to lock without waiting, until a scan finds every shard empty.
+     * 
+     * Runtime: \f$ O(\log n) \f$ amortized, if not contended
+     * 
+     * @param element Receives the value of the deleted element
+     * @param key Receives the key of the deleted element
+     * @return true if an element was deleted, false if the queue was empty
+     */
+    bool tryDeleteMin(V& element, K& key);
+
+    /**
+     * @brief Deletes an element with small key and returns its value.
+     * 
+     * @param element Receives the value of the deleted element
+     * @return true if an element was deleted, false if the queue was empty
+     */
+    bool tryDeleteMin(V& element)
+    {
+        K key;
+
+        return tryDeleteMin(element, key);
+    }
+
+private:
+    static std::uint64_t _random();
+
+    Shard* _sample();
+
+    void _publish(Shard* shard);
+
+    void _pop(Shard* shard, V& element, K& key);
+};
+
+#include "MultiQueue.hpp"
@@ -0,0 +1,155 @@
+template<class V, class K>
+int MultiQueue<V, K>::size()
+{
+    int count = 0;
+    for (std::size_t i = 0; i < shards.size(); ++i)
+    {
+        count += shards[i]->count.load(std::memory_order_relaxed);
+    }
+
+    return count;
+}
+
+template<class V, class K>
+void MultiQueue<V, K>::insert(V element, K key)
+{
+    while (true)
+    {
+        Shard* shard = _sample();
+
+        if (shard->mutex.try_lock())
+        {
+            shard->heap.insert(std::move(element), std::move(key));
+            _publish(shard);
+            shard->mutex.unlock();
+
+            return;
+        }
+    }
+}
+
+template<class V, class K>
+bool MultiQueue<V, K>::tryDeleteMin(V& element, K& key)
+{
+    // two choices per attempt
+    for (std::size_t attempt = 0; attempt < 2 * shards.size(); ++attempt)
+    {
+        Shard* a = _sample();
+        Shard* b = _sample();
+
+        bool hasA = a->count.load(std::memory_order_relaxed) > 0;
+        bool hasB = b->count.load(std::memory_order_relaxed) > 0;
+
+        Shard* shard = NULL;
+        if (hasA && hasB)
+        {
+            shard = (b->top.load(std::memory_order_relaxed) 
+                < a->top.load(std::memory_order_relaxed)) ? b : a;
+        }
+        else if (hasA || hasB)
+        {
+            shard = hasA ? a : b;
+        }
+
+        if (!shard || !shard->mutex.try_lock())
+        {
+            continue;
+        }
+
+        if (shard->heap.empty())
+        {
+            shard->mutex.unlock();
+            continue;
+        }
+
+        _pop(shard, element, key);
+        shard->mutex.unlock();
+
+        return true;
+    }
+
+    // the queue is (almost) empty or contended, scan all shards
+    while (true)
+    {
+        Shard* shard = NULL;
+
+        // start at a random shard, such that threads do not queue up
+        std::size_t start = (_random() >> 32) % shards.size();
+        for (std::size_t i = 0; i < shards.size(); ++i)
+        {
+            Shard* current = shards[(start + i) % shards.size()].get();
+            if (current->count.load(std::memory_order_relaxed) == 0)
+            {
+                continue;
+            }
+
+            if (!shard || current->top.load(std::memory_order_relaxed) 
+                < shard->top.load(std::memory_order_relaxed))
+            {
+                shard = current;
+            }
+        }
+
+        if (!shard)
+        {
+            return false;
+        }
+
+        if (!shard->mutex.try_lock())
+        {
+            continue;
+        }
+
+        if (!shard->heap.empty())
+        {
+            _pop(shard, element, key);
+            shard->mutex.unlock();
+
+            return true;
+        }
+
+        shard->mutex.unlock();
+    }
+}
+
+template<class V, class K>
+std::uint64_t MultiQueue<V, K>::_random()
+{
+    static std::atomic<std::uint64_t> seed(0x9e3779b97f4a7c15ull);
+    static thread_local std::uint64_t state = 
+        seed.fetch_add(0x9e3779b97f4a7c15ull, std::memory_order_relaxed) | 1;
+
+    // xorshift64*
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    return state * 0x2545f4914f6cdd1dull;
+}
+
+template<class V, class K>
+typename MultiQueue<V, K>::Shard* MultiQueue<V, K>::_sample()
+{
+    return shards[(_random() >> 32) % shards.size()].get();
+}
+
+template<class V, class K>
+void MultiQueue<V, K>::_publish(Shard* shard)
+{
+    if (!shard->heap.empty())
+    {
+        shard->top.store(shard->heap.getMinPtr()->getKey(), 
+            std::memory_order_relaxed);
+    }
+
+    shard->count.store(shard->heap.size(), std::memory_order_relaxed);
+}
+
+template<class V, class K>
+void MultiQueue<V, K>::_pop(Shard* shard, V& element, K& key)
+{
+    key = shard->heap.getMinPtr()->getKey();
+    element = shard->heap.deleteMin();
+
+    _publish(shard);
+}
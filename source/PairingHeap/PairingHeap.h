@@ -1,8 +1,31 @@
 #pragma once
 
-#include "../interface/IHeap.h"
-
-template<class V, class K> class PairingHeap;
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../memory/ValueLayout.h"
+#include "../util/Bits.h"
+#include "../util/HeapStats.h"
+#include "../util/Snapshot.h"
+#include "PairingStrategy.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template<class V, class K, class Compare = std::less<K>, 
+    class Pairing = LazyPairing, class Stats = NoStats, 
+    class Layout = InlineValues> 
+class PairingHeap;
 
 /**
  * @brief Template for nodes of a pairing heap.
@@ -14,19 +37,22 @@ template<class V, class K> class PairingHeap;
  * 
  * @tparam V Template parameter for value types
  * @tparam K Template parameter for key types
+ * @tparam Layout Template parameter for the node layout, either 
+ * `InlineValues` or `SplitValues`
  */
-template<class V, class K> 
+template<class V, class K, class Layout = InlineValues> 
 struct Node : public INode<V, K> 
 {
 public:
-    friend class PairingHeap<V, K>;
+    template<class, class, class, class, class, class> 
+    friend class PairingHeap;
 
     /**
      * @brief Get the parent node.
      * 
      * @return A pointer to the parent node
      */
-    Node<V, K>* getParent() 
+    Node* getParent() 
     { 
         return parent; 
     }
@@ -36,7 +62,7 @@ public:
      * 
      * @return A pointer to the left sibling node
      */
-    Node<V, K>* getLeft() 
+    Node* getLeft() 
     { 
         return left; 
     }
@@ -46,7 +72,7 @@ public:
      * 
      * @return A pointer to the right sibling node
      */
-    Node<V, K>* getRight() 
+    Node* getRight() 
     { 
         return right; 
     }
@@ -56,7 +82,7 @@ public:
      * 
      * @return A pointer to one child node
      */
-    Node<V, K>* getChild() 
+    Node* getChild() 
     { 
         return child; 
     }
@@ -68,7 +94,7 @@ public:
      */
     V getValue() 
     { 
-        return value; 
+        return value.get(); 
     }
 
     /**
@@ -81,23 +107,30 @@ public:
         return key;
     }
 
-    bool hasChildren() override 
+    bool hasChildren() 
     { 
         return child; 
     }
 
-    bool hasParents() override 
+    bool hasParent() 
     { 
         return parent; 
     }
 
 private:
-    Node<V, K>* parent;
-    Node<V, K>* left;
-    Node<V, K>* right;
-    Node<V, K>* child;
+    template<class... Args>
+    Node(K key, typename Layout::template Store<V>& store, 
+        Args&&... args)
+    : value(store, std::forward<Args>(args)...), key(std::move(key))
+    {
+    }
+
+    Node* parent;
+    Node* left;
+    Node* right;
+    Node* child;
 
-    V value;
+    typename Layout::template Slot<V> value;
     K key;
 };
 
@@ -109,40 +142,134 @@ private:
  * 
  * This allows for insertions and merging in constant time as well as 
  * deletions in logarithmic time.
+ *
+ * How trees are combined when deleting the minimum is chosen at compile time 
+ * by a pairing strategy: `LazyPairing`, `TwoPassPairing`, `MultipassPairing` 
+ * or `AuxiliaryTwoPassPairing`. With a work budget, see `setBudget`, trees 
+ * are paired incrementally by every operation instead, which bounds the 
+ * number of trees a deletion has to combine.
+ *
+ * Values are stored within the nodes. The layout `SplitValues` keeps them in 
+ * a separate pool instead, such that restructuring the trees, which only 
+ * touches keys and links, works on compact nodes.
+ *
+ * All operations are statically dispatched. Use `HeapAdapter` to access the 
+ * heap through `IHeap`.
  * 
  * @tparam V Template parameter for value types
  * @tparam K Template parameter for key types
+ * @tparam Compare Template parameter for the strict weak ordering of keys, 
+ * the heap maintains the smallest key with respect to it
+ * @tparam Pairing Template parameter for the pairing strategy
+ * @tparam Stats Template parameter for the instrumentation policy, either 
+ * `NoStats` or `CountingStats`
+ * @tparam Layout Template parameter for the node layout, either 
+ * `InlineValues` or `SplitValues`
  */
-template<class V, class K> 
-class PairingHeap : public IHeap<V, K>
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout> 
+class PairingHeap 
+: public HeapBase<PairingHeap<V, K, Compare, Pairing, Stats, Layout>, V, K, 
+    Node<V, K, Layout>*>
 {
 private:
-    Node<V, K>* forest;
-    Node<V, K>* minPtr;
+    Node<V, K, Layout>* forest;
+    Node<V, K, Layout>* minPtr;
     int count;
 
+    // slots[i] holds a tree of 2^i paired trees, see setBudget
+    Node<V, K, Layout>* slots[64];
+    std::uint64_t occupied;
+
+    std::shared_ptr<NodePool<Node<V, K, Layout>>> pool;
+
+    // values of the nodes, unless stored within the nodes
+    typename Layout::template Store<V> values;
+
+    // auxiliary heap of deleteMinBatch, kept to reuse its memory
+    std::vector<Node<V, K, Layout>*> candidates;
+
+    Compare compare;
+
+    Stats statistics;
+
+    // trees paired per operation, 0 for pairing by the strategy
+    int budget;
+
 public:
     /**
-     * @brief Constructs a new pairing heap.
+     * @brief Constructs a new pairing heap with its own node pool.
      * 
+     * @param compare The ordering of keys
      */
-    PairingHeap()
+    explicit PairingHeap(const Compare& compare = Compare())
+    : pool(std::make_shared<NodePool<Node<V, K, Layout>>>()), compare(compare)
     {
+        budget = 0;
+
         _init();
     }
 
+    /**
+     * @brief Constructs a new pairing heap allocating from a given pool.
+     *
+     * Heaps that are going to be merged should share one pool, such that 
+     * merging does not need to transfer or retain any slabs.
+     * 
+     * @param pool The node pool to allocate nodes from
+     * @param compare The ordering of keys
+     */
+    explicit PairingHeap(std::shared_ptr<NodePool<Node<V, K, Layout>>> pool, 
+        const Compare& compare = Compare())
+    : pool(pool), compare(compare)
+    {
+        assert(pool);
+
+        budget = 0;
+
+        _init();
+    }
+
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
     /**
      * @brief Destroys the pairing heap.
      *
-     * Recursively deletes all nodes of all trees maintained by the heap.
+     * Deletes all nodes of all trees maintained by the heap.
      * 
      */
-    virtual ~PairingHeap()
+    ~PairingHeap()
     {
-        if (forest)
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the pairing heap.
+     *
+     * If the heap is the only user of its node pool and nodes are trivially 
+     * destructible, all slabs are released at once. Otherwise, every node is 
+     * destroyed and returned to the pool separately.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(n) \f$, respectively
+     */
+    void clear()
+    {
+        _flushSlots();
+
+        if (pool.use_count() == 1 
+            && std::is_trivially_destructible<Node<V, K, Layout>>::value
+            && values.releasable())
+        {
+            pool->release();
+            values.release();
+        }
+        else if (forest)
         {
             _deleteAll(forest);
         }
+
+        _init();
     }
 
     /**
@@ -153,21 +280,109 @@ public:
      *
      * `key[i]` is the key associated with `elements[i]`.
      *
-     * This implementation inserts every key-value-pair separately. 
+     * This implementation copies all key-value-pairs into the heap at once. 
      * 
-     * Runtime: \f$ O(\log n)\f$
+     * Runtime: \f$ O(n) \f$
      * 
-     * @param elements 
-     * @param keys 
+     * @param elements Vector of values to insert
+     * @param keys Vector of keys
      */
-    void build(std::vector<V>& elements, std::vector<K>& keys) override
+    void build(std::vector<V>& elements, std::vector<K>& keys)
     {
         assert(elements.size() == keys.size());
 
-        for (int i = 0; i < elements.size(); ++i)
+        build(elements.begin(), elements.end(), keys.begin());
+    }
+
+    /**
+     * @brief Inserts a range of values with associated keys at once.
+     *
+     * The value at position `i` of the range `[first, last)` is associated 
+     * with the key at position `i` behind `keys`. Values are copied into the 
+     * heap nodes or moved if `first` and `last` are move iterators, hence 
+     * move-only value types are supported.
+     *
+     * All nodes are allocated within one contiguous slab and combined into 
+     * a single new tree by multipass pairing, i.e. by repeatedly linking 
+     * pairs of trees until one tree remains.
+     * 
+     * Runtime: \f$ O(n) \f$
+     * 
+     * @tparam ValueIterator Template parameter for forward iterators of values
+     * @tparam KeyIterator Template parameter for input iterators of keys
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     * @return Pointers to the new heap nodes in the order of the range
+     */
+    template<class ValueIterator, class KeyIterator>
+    std::vector<Node<V, K, Layout>*> build(
+        ValueIterator first, ValueIterator last, KeyIterator keys)
+    {
+        std::vector<Node<V, K, Layout>*> nodes;
+        pool->allocateBulk(std::distance(first, last), nodes);
+
+        for (std::size_t i = 0; first != last; ++first, ++keys, ++i)
         {
-            insert(elements[i], keys[i]);
+            new (nodes[i]) Node<V, K, Layout>(*keys, values, *first);
         }
+
+        _buildTree(nodes);
+
+        return nodes;
+    }
+
+    /**
+     * @brief Inserts a batch of values with associated keys.
+     *
+     * The value at position `i` of the range `[first, last)` is associated 
+     * with the key at position `i` behind `keys`.
+     *
+     * Every new node is allocated from the free list of the node pool. The 
+     * batch is combined into a single new tree on the fly by linking trees of 
+     * equal size, like incrementing a binary counter.
+     * 
+     * Runtime: \f$ O(m) \f$ for \f$ m \f$ new elements
+     * 
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     * @param handles Vector the pointers to the new heap nodes are appended to
+     */
+    template<class ValueIterator, class KeyIterator>
+    void insertBatch(ValueIterator first, ValueIterator last, KeyIterator keys, 
+        std::vector<Node<V, K, Layout>*>& handles)
+    {
+        _insertBatch(first, last, keys, &handles);
+    }
+
+    /**
+     * @brief Inserts a batch of values with associated keys, discarding the 
+     * handles of the new heap nodes.
+     * 
+     * @param first Iterator to the first value
+     * @param last Iterator behind the last value
+     * @param keys Iterator to the key of the first value
+     */
+    template<class ValueIterator, class KeyIterator>
+    void insertBatch(ValueIterator first, ValueIterator last, KeyIterator keys)
+    {
+        _insertBatch(first, last, keys, 
+            static_cast<std::vector<Node<V, K, Layout>*>*>(NULL));
+    }
+
+    /**
+     * @brief Reserves space for a number of elements.
+     * 
+     * Neither the node pool nor the value storage grow until more than `n` 
+     * elements are in the heap.
+     * 
+     * @param n Number of elements to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        pool->reserve(n);
+        values.reserve(n);
     }
 
     /**
@@ -177,7 +392,7 @@ public:
      * 
      * @return The current size of the heap
      */
-    int size() override
+    int size()
     {
         return count;
     }
@@ -186,21 +401,60 @@ public:
      * @brief Inserts a key-value-pair into the pairing heap.
      *
      * This implementation inserts a key-value-pair by inserting a new node 
-     * as a new tree into the forest.
+     * as a new tree into the forest. The value is copied into the node once.
      * 
      * Runtime: \f$ O(1) \f$
      * 
      * @param element Value to insert
      * @param key Key associated with `value`
-     * @return A pointer to the resulting pairing heap node
+     * @return A pointer to the resulting heap node
      */
-    INode<V, K>* insert(V element, K key) override
+    Node<V, K, Layout>* insert(const V& element, const K& key)
     {
-        Node<V, K>* node = _singleton(element, key);
+        return emplace(key, element);
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the pairing heap, moving both 
+     * into the new node.
+     * 
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @param element Value to insert
+     * @param key Key associated with `value`
+     * @return A pointer to the resulting heap node
+     */
+    Node<V, K, Layout>* insert(V&& element, K&& key)
+    {
+        return emplace(std::move(key), std::move(element));
+    }
+
+    /**
+     * @brief Inserts a value constructed in place from given arguments.
+     *
+     * The value is constructed in place, within the new node or within the 
+     * value storage of the heap, hence it is neither copied nor moved.
+     * 
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @param key Key associated with the new value
+     * @param args Arguments passed to the constructor of the value
+     * @return A pointer to the resulting heap node
+     */
+    template<class... Args>
+    Node<V, K, Layout>* emplace(K key, Args&&... args)
+    {
+        Node<V, K, Layout>* node = _singleton(std::move(key), 
+            std::forward<Args>(args)...);
         _newTree(node);
 
         ++count;
 
+        if (budget)
+        {
+            _consolidate(budget);
+        }
+
         return node;
     }
 
@@ -209,48 +463,80 @@ public:
      * 
      * Runtime: \f$ O(1) \f$
      * 
-     * @return Value of the smallest element
+     * @return A reference to the value of the smallest element, valid until 
+     * the element is deleted
      */
-    V min() override
+    const V& min()
     {
-        return minPtr->getValue();
+        assert(minPtr);
+
+        return minPtr->value.get();
     }
 
     /**
      * @brief Deletes the heap node with smallest key and returns its value.
      * 
+     * The value is moved out of the node before the node is deleted.
+     * 
      * Runtime: \f$ O(\log n) \f$ amortized
      *
      * @return The value of the smallest element
      */
-    V deleteMin() override
+    V deleteMin()
     {
-        V value = minPtr->getValue();
+        assert(minPtr);
 
-        _deleteMin();
+        V value = std::move(minPtr->value.get());
 
-        count = (count > 0) ? count-- : 0;
+        _deleteRoot(minPtr);
 
         return value;
     }
 
+    /**
+     * @brief Deletes the `k` heap nodes with smallest keys.
+     *
+     * The values are appended to `out` in ascending order of their keys. If 
+     * the heap contains fewer than `k` nodes, all nodes are deleted.
+     *
+     * Instead of pairing the roots after every deletion, all roots are kept 
+     * in an auxiliary binary heap. Deleting a node pushes its children into 
+     * the auxiliary heap. Afterwards, the remaining candidates are linked 
+     * pair-wise until a single tree remains.
+     * 
+     * Runtime: \f$ O(r + c \log c) \f$ amortized for \f$ r \f$ roots and 
+     * \f$ c \f$ candidates
+     *
+     * @param k Number of nodes to delete
+     * @param out Vector the values are appended to
+     * @return The number of deleted nodes
+     */
+    int deleteMinBatch(int k, std::vector<V>& out);
+
     /**
      * @brief Removes a given node from the pairing heap.
      *
-     * The key associated with the node is first decreased such that the new key
-     * is smaller than any other key. Afterwards, the element with smallest key,
-     * i.e. the given node, is deleted.
+     * If the node is not a root, its subtree is cut from its parent. 
+     * Afterwards, the node is deleted as a root. Its key is never compared 
+     * to a sentinel, hence any key type and order is supported.
      * 
      * Runtime: \f$ O(\log n) \f$ amortized
      * 
      * @param handle Pointer to the node to remove
      * @return Value of the deleted node
      */
-    V remove(INode<V, K>* handle) override
+    V remove(Node<V, K, Layout>* handle)
     {
-        decreaseKey(handle, minPtr->getKey() - 1);
+        V value = std::move(handle->value.get());
+
+        if (handle->parent)
+        {
+            _cut(handle);
+        }
 
-        deleteMin();
+        _deleteRoot(handle);
+
+        return value;
     }
 
     /**
@@ -261,41 +547,180 @@ public:
      * @param handle Pointer to the heap node 
      * @param key New key value of the heap node
      */
-    void decreaseKey(INode<V, K>* handle, K key) override
+    void decreaseKey(Node<V, K, Layout>* handle, K key)
     {
-        if (key < handle->getKey())
+        statistics.comparison();
+        if (compare(key, handle->key))
         {
             _decreaseKey(handle, key);
         }
+
+        if (budget)
+        {
+            _consolidate(budget);
+        }
     }
 
     /**
      * @brief Merges two instances of pairing heaps.
      * 
-     * The new forest becomes the union of both forests.
+     * The new forest becomes the union of both forests and `heap` is left 
+     * empty. Nodes of `heap` move into this heap, hence their storage must 
+     * outlive this heap: if both heaps use different node pools, the slabs of 
+     * the other pool are either moved into the pool of this heap or, if the 
+     * other pool is still shared with further heaps, retained by it.
      *
-     * Runtime: \f$ O(1) \f$
+     * With a work budget, all trees of `heap` are consolidated right away, 
+     * such that deletions do not scan them.
      *
-     * @param other Pointer to the pairing heap to merge with
+     * Runtime: \f$ O(1) \f$ for shared pools, \f$ O(t + \log n) \f$ for 
+     * \f$ t \f$ trees with a work budget
+     *
+     * @param heap Pointer to the pairing heap to merge with
      */
-    void merge(PairingHeap<V, K>* other) override
+    void merge(PairingHeap<V, K, Compare, Pairing, Stats, Layout>* heap)
     {
-        if (other->getMinPtr()->getKey() < minPtr->getKey())
+        if (heap == this)
+        {
+            return;
+        }
+
+        heap->_flushSlots();
+        if (!heap->forest)
+        {
+            return;
+        }
+
+        if (heap->pool != pool)
         {
-            minPtr = other->getMinPtr();
+            if (heap->pool.use_count() == 1)
+            {
+                pool->splice(*heap->pool);
+            }
+            else
+            {
+                pool->retain(heap->pool);
+            }
         }
 
-        _insertForest(other->getForest());
-        other->getForest() = NULL;
+        values.merge(heap->values);
+
+        statistics.comparison();
+        if (!minPtr || compare(heap->minPtr->key, minPtr->key))
+        {
+            minPtr = heap->minPtr;
+        }
+
+        _insertForest(heap->forest);
+        count += heap->count;
+
+        // consolidate all trees of heap, which deletions would scan otherwise
+        if (budget)
+        {
+            _consolidate(count);
+        }
+
+        heap->_init();
+    }
+
+    /**
+     * @brief Sets the number of trees paired per operation.
+     *
+     * By default, the budget is 0 and deleting the minimum combines all 
+     * trees of the forest by the pairing strategy at once. With a positive 
+     * budget, paired trees are kept in slots between operations, where slot 
+     * `i` holds a tree combined from \f$ 2^i \f$ trees of the forest: every 
+     * insertion and every decrease of a key moves up to `budget` trees of 
+     * the forest into the slots, linking trees of equal slots like a binary 
+     * counter. Deleting the minimum moves `budget` trees as well as the 
+     * children of the deleted node and determines the new minimum among the 
+     * slots and the remaining trees of the forest. The pairing strategy is 
+     * not used then.
+     *
+     * Trees paired this way have logarithmic degree, hence the forest stays 
+     * short and deletions take logarithmic time instead of time linear in 
+     * the number of insertions since the last deletion. Setting a positive 
+     * budget pairs all trees of the forest at once, setting the budget to 0 
+     * moves all paired trees back into the forest.
+     * 
+     * Runtime: \f$ O(t + \log n) \f$ for \f$ t \f$ trees in the forest
+     *
+     * @param budget Number of trees to pair per operation, 0 for pairing by 
+     * the strategy
+     */
+    void setBudget(int budget);
+
+    /**
+     * @brief Gets the number of trees paired per operation.
+     * 
+     * @return The work budget, 0 for pairing by the strategy
+     */
+    int getBudget()
+    {
+        return budget;
+    }
+
+    /**
+     * @brief Writes a snapshot of the pairing heap to a file.
+     *
+     * The snapshot preserves the shape of all trees. Nodes are 
+     * numbered breadth-first, one list of siblings after another, and refer 
+     * to each other by these numbers, see `SnapshotNode`. Values and keys 
+     * must be trivially copyable.
+     * 
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param path Path of the file to write
+     * @return true if the snapshot was written, false otherwise
+     */
+    bool save(const char* path);
+
+    /**
+     * @brief Replaces all nodes of the pairing heap by a snapshot file.
+     *
+     * The file is mapped into memory and all nodes are constructed within 
+     * one contiguous slab in a single pass. Trees keep their shape, hence 
+     * the heap is not consolidated. If the file is no valid snapshot of a 
+     * pairing heap with the same value and key types, the heap is left 
+     * unchanged.
+     * 
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param path Path of the file to read
+     * @param handles Vector the pointers to the loaded nodes are appended to, 
+     * in the order of the file
+     * @return true if the snapshot was loaded, false otherwise
+     */
+    bool load(const char* path, std::vector<Node<V, K, Layout>*>& handles)
+    {
+        return _load(path, &handles);
+    }
+
+    /**
+     * @brief Replaces all nodes of the pairing heap by a snapshot file, 
+     * discarding the handles of the loaded nodes.
+     * 
+     * @param path Path of the file to read
+     * @return true if the snapshot was loaded, false otherwise
+     */
+    bool load(const char* path)
+    {
+        return _load(path, 
+            static_cast<std::vector<Node<V, K, Layout>*>*>(NULL));
     }
 
     /**
      * @brief Gets the forest of trees.
+     *
+     * Trees paired with a work budget are moved back into the forest first, 
+     * such that it contains all trees.
      * 
      * @return A pointer to the first tree in the forest.
      */
-    Node<V, K>* getForest()
+    Node<V, K, Layout>* getForest()
     {
+        _flushSlots();
+
         return forest;
     }
 
@@ -304,31 +729,119 @@ public:
      * 
      * @return A pointer to the smallest element
      */
-    Node<V, K>* getMinPtr()
+    Node<V, K, Layout>* getMinPtr()
     {
         return minPtr;
     }
 
+    /**
+     * @brief Gets the operation counters of the heap.
+     *
+     * Counters are only maintained if the heap is instantiated with 
+     * `CountingStats`.
+     * 
+     * @return The instrumentation policy of the heap
+     */
+    const Stats& stats()
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief Resets the operation counters of the heap.
+     * 
+     */
+    void resetStats()
+    {
+        statistics.reset();
+    }
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     * 
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<Node<V, K, Layout>>> getPool()
+    {
+        return pool;
+    }
+
 private:
     void _init();
 
-    void _deleteAll(Node<V, K>* handle);
+    void _deleteAll(Node<V, K, Layout>* handle);
+
+    void _free(Node<V, K, Layout>* handle);
+
+    template<class... Args>
+    Node<V, K, Layout>* _singleton(K key, Args&&... args);
+
+    void _newTree(Node<V, K, Layout>* handle);
+
+    void _buildTree(std::vector<Node<V, K, Layout>*>& nodes);
+
+    void _cut(Node<V, K, Layout>* handle);
+
+    void _link(Node<V, K, Layout>* a, Node<V, K, Layout>* b);
+
+    Node<V, K, Layout>* _union(Node<V, K, Layout>* a, Node<V, K, Layout>* b);
+
+    void _removeRoot(Node<V, K, Layout>* handle);
+
+    void _deleteRoot(Node<V, K, Layout>* handle);
+
+    Node<V, K, Layout>* _pop(Node<V, K, Layout>*& list);
+
+    Node<V, K, Layout>* _concat(Node<V, K, Layout>* a, Node<V, K, Layout>* b);
 
-    Node<V, K>* _singleton(V element, K key);
+    Node<V, K, Layout>* _twoPass(Node<V, K, Layout>* list);
 
-    void _newTree(Node<V, K>* handle);
+    Node<V, K, Layout>* _multipass(Node<V, K, Layout>* list);
 
-    void _cut(Node<V, K>* handle);
+    void _pair(Node<V, K, Layout>* roots, Node<V, K, Layout>* children, 
+        LazyPairing);
 
-    void _link(Node<V, K>* a, Node<V, K>* b);
+    void _pair(Node<V, K, Layout>* roots, Node<V, K, Layout>* children, 
+        TwoPassPairing);
 
-    void _union(Node<V, K>* a, Node<V, K>* b);
+    void _pair(Node<V, K, Layout>* roots, Node<V, K, Layout>* children, 
+        MultipassPairing);
 
-    void _deleteMin();
+    void _pair(Node<V, K, Layout>* roots, Node<V, K, Layout>* children, 
+        AuxiliaryTwoPassPairing);
 
-    void _decreaseKey(Node<V, K>* handle, K key);
+    void _decreaseKey(Node<V, K, Layout>* handle, K key);
 
-    void _insertForest(Node<V, K>* other);
+    void _insertForest(Node<V, K, Layout>* other);
+
+    bool _unslot(Node<V, K, Layout>* handle);
+
+    void _flushSlots();
+
+    void _consolidate(int trees);
+
+    void _findMin();
+
+    void _snapshotList(Node<V, K, Layout>* first, std::uint32_t parent, 
+        std::vector<SnapshotNode<V, K>>& nodes, 
+        std::vector<Node<V, K, Layout>*>& order);
+
+    bool _load(const char* path, std::vector<Node<V, K, Layout>*>* handles);
+
+    template<class ValueIterator, class KeyIterator>
+    void _insertBatch(ValueIterator first, ValueIterator last, 
+        KeyIterator keys, std::vector<Node<V, K, Layout>*>* handles);
+
+    // orders nodes by descending keys for the auxiliary heap
+    struct Greater
+    {
+        Compare compare;
+
+        bool operator()(Node<V, K, Layout>* a, Node<V, K, Layout>* b)
+        {
+            return compare(b->key, a->key);
+        }
+    };
 };
 
 #include "PairingHeap.hpp"
\ No newline at end of file
@@ -1,66 +1,122 @@
-template<class V, class K>
-void PairingHeap<V, K>::_init()
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_init()
 {
     forest = NULL;
     minPtr = NULL;
     count = 0;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        slots[i] = NULL;
+    }
+    occupied = 0;
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_deleteAll(Node<V, K>* handle)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_deleteAll(
+    Node<V, K, Layout>* handle)
 {
     if (handle)
     {
-        Node<V, K>* current = handle;
-        do 
+        // open the circular list to terminate the traversal
+        handle->left->right = NULL;
+
+        Node<V, K, Layout>* current = handle;
+        while (current)
         {
-            Node<V, K>* node = current;
+            // splice children into the list behind the current node
+            if (current->child)
+            {
+                Node<V, K, Layout>* first = current->child;
+                Node<V, K, Layout>* last = first->left;
+                last->right = current->right;
+                current->right = first;
+            }
+
+            Node<V, K, Layout>* node = current;
             current = current->right;
-            _deleteAll(node->child);
-            delete node;
+            _free(node);
         }
-        while (current != handle);
     }
 }
 
-template<class V, class K>
-Node<V, K>* PairingHeap<V, K>::_singleton(V element, K key)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_free(
+    Node<V, K, Layout>* handle)
 {
-    Node<V, K>* node = new Node<V, K>;
+    values.destroy(handle->value);
+    handle->~Node<V, K, Layout>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+template<class... Args>
+Node<V, K, Layout>* 
+PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_singleton(
+    K key, Args&&... args)
+{
+    Node<V, K, Layout>* node = new (pool->allocate()) 
+        Node<V, K, Layout>(std::move(key), values, 
+            std::forward<Args>(args)...);
 
     node->parent = NULL;
     node->left = node;
     node->right = node;
     node->child = NULL;
 
-    node->value = element;
-    node->key = key;
-
     return node;
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_newTree(Node<V, K>* handle)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_newTree(
+    Node<V, K, Layout>* handle)
 {
-    Node<V, K>* end = forest->left;
-    forest->left = handle;
-    handle->left = end;
-    handle->right = forest;
-    end->right = handle;
+    if (!forest)
+    {
+        handle->left = handle;
+        handle->right = handle;
+        forest = handle;
+    }
+    else
+    {
+        Node<V, K, Layout>* end = forest->left;
+        forest->left = handle;
+        handle->left = end;
+        handle->right = forest;
+        end->right = handle;
+    }
+
+    // with a work budget, the minimum may be a tree of the slots
+    if (!minPtr)
+    {
+        minPtr = handle;
+
+        return;
+    }
 
-    if (handle->key < minPtr->key)
+    statistics.comparison();
+    if (compare(handle->key, minPtr->key))
     {
         minPtr = handle;
     }
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_cut(Node<V, K>* handle)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_cut(
+    Node<V, K, Layout>* handle)
 {
+    Node<V, K, Layout>* parent = handle->parent;
+
     // advance child pointer of parent
-    if (handle->parent->child == handle)
+    if (parent->child == handle)
     {
-        handle->parent->child == handle->right;
+        parent->child = (handle->right != handle) ? handle->right : NULL;
     }
 
     // remove subtree rooted at handle
@@ -71,12 +127,16 @@ void PairingHeap<V, K>::_cut(Node<V, K>* handle)
 
     handle->parent = NULL;
 
+    statistics.cut();
+
     // insert handle as new tree
     _newTree(handle);
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_link(Node<V, K>* a, Node<V, K>* b)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_link(
+    Node<V, K, Layout>* a, Node<V, K, Layout>* b)
 {
     b->left->right = b->right;
     b->right->left = b->left;
@@ -96,79 +156,307 @@ void PairingHeap<V, K>::_link(Node<V, K>* a, Node<V, K>* b)
         b->left = b;
         b->right = b;
     }
+
+    b->parent = a;
+
+    statistics.link();
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_union(Node<V, K>* a, Node<V, K>* b)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+Node<V, K, Layout>* PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_union(
+    Node<V, K, Layout>* a, Node<V, K, Layout>* b)
 {
     assert(!a->parent);
     assert(!b->parent);
 
-    if (a->key < b->key)
+    statistics.comparison();
+    if (compare(a->key, b->key))
     {
         _link(a, b);
+
+        return a;
     }
     else
     {
         _link(b, a);
+
+        return b;
     }
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_deleteMin()
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_removeRoot(
+    Node<V, K, Layout>* handle)
 {
-    auto handle = minPtr;
-
-    // connect siblings
-    if (handle->left == handle || handle->right == handle)
+    if (handle->right == handle)
     {
-        handle->left = NULL;
-        handle->right = NULL;
+        forest = NULL;
     }
     else
     {
         handle->left->right = handle->right;
         handle->right->left = handle->left;
-    }
 
-    // connect parent to next child
-    if (handle->parent)
-    {
-        handle->parent->child = handle->right;
-        handle->parent = NULL;
+        if (forest == handle)
+        {
+            forest = handle->right;
+        }
     }
 
-    // add children as new trees
-    if (handle->child)
+    handle->left = handle;
+    handle->right = handle;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_deleteRoot(
+    Node<V, K, Layout>* handle)
+{
+    // detach children as a linear list
+    Node<V, K, Layout>* children = handle->child;
+    int degree = 0;
+    if (children)
     {
-        auto current = handle->child;
+        auto current = children;
         do
         {
-            auto node = current;
+            current->parent = NULL;
             current = current->right;
+            ++degree;
+        }
+        while (current != children);
+
+        handle->child = NULL;
+    }
+
+    if (!_unslot(handle))
+    {
+        _removeRoot(handle);
+    }
+    _free(handle);
 
-            _newTree(node);
+    --count;
+
+    // with a work budget, children become new trees paired incrementally
+    if (budget)
+    {
+        minPtr = NULL;
+
+        _insertForest(children);
+        _consolidate(budget + degree);
+        _findMin();
+
+        return;
+    }
+
+    if (children)
+    {
+        children->left->right = NULL;
+    }
+
+    // detach remaining roots as a linear list
+    Node<V, K, Layout>* roots = forest;
+    if (roots)
+    {
+        roots->left->right = NULL;
+    }
+
+    forest = NULL;
+    minPtr = NULL;
+
+    // counting the trees takes an extra pass, only if instrumented
+    if (Stats::enabled)
+    {
+        std::uint64_t trees = 0;
+        for (Node<V, K, Layout>* node = roots; node; node = node->right)
+        {
+            ++trees;
+        }
+        for (Node<V, K, Layout>* node = children; node; node = node->right)
+        {
+            ++trees;
         }
-        while (current != handle->child);
+
+        statistics.consolidation(trees);
     }
 
-    delete handle;
+    _pair(roots, children, Pairing());
+}
 
-    // perform pair-wise union operations on roots
-    auto current = forest->right;
-    do
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+Node<V, K, Layout>* PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pop(
+    Node<V, K, Layout>*& list)
+{
+    Node<V, K, Layout>* node = list;
+    list = node->right;
+
+    node->left = node;
+    node->right = node;
+
+    return node;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+Node<V, K, Layout>* PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_concat(
+    Node<V, K, Layout>* a, Node<V, K, Layout>* b)
+{
+    if (!a)
     {
-        auto node = current;
-        current = current->right->right;
+        return b;
+    }
 
-        _union(node, node->right);
+    Node<V, K, Layout>* end = a;
+    while (end->right)
+    {
+        end = end->right;
     }
-    while (current != forest && current != forest->right);
+    end->right = b;
 
+    return a;
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_decreaseKey(Node<V, K>* handle, K key)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+Node<V, K, Layout>* 
+PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_twoPass(
+    Node<V, K, Layout>* list)
+{
+    // link pairs from left to right, stacking the survivors
+    Node<V, K, Layout>* stack = NULL;
+    while (list)
+    {
+        Node<V, K, Layout>* node = _pop(list);
+        if (list)
+        {
+            node = _union(node, _pop(list));
+        }
+
+        node->right = stack;
+        stack = node;
+    }
+
+    // link survivors from right to left
+    Node<V, K, Layout>* root = NULL;
+    while (stack)
+    {
+        Node<V, K, Layout>* node = _pop(stack);
+        root = root ? _union(root, node) : node;
+    }
+
+    return root;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+Node<V, K, Layout>* 
+PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_multipass(
+    Node<V, K, Layout>* list)
+{
+    if (!list)
+    {
+        return NULL;
+    }
+
+    Node<V, K, Layout>* end = list;
+    while (end->right)
+    {
+        end = end->right;
+    }
+
+    // link the first two trees and append the result to the queue
+    while (list != end)
+    {
+        Node<V, K, Layout>* a = _pop(list);
+        Node<V, K, Layout>* b = _pop(list);
+        Node<V, K, Layout>* node = _union(a, b);
+
+        node->right = NULL;
+        if (list)
+        {
+            end->right = node;
+        }
+        else
+        {
+            list = node;
+        }
+        end = node;
+    }
+
+    list->left = list;
+    list->right = list;
+
+    return list;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pair(
+    Node<V, K, Layout>* roots, Node<V, K, Layout>* children, LazyPairing)
+{
+    // perform pair-wise union operations on children, followed by roots
+    Node<V, K, Layout>* current = _concat(children, roots);
+
+    while (current)
+    {
+        Node<V, K, Layout>* node = _pop(current);
+
+        if (current)
+        {
+            node = _union(node, _pop(current));
+        }
+
+        _newTree(node);
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pair(
+    Node<V, K, Layout>* roots, Node<V, K, Layout>* children, TwoPassPairing)
+{
+    Node<V, K, Layout>* root = _twoPass(_concat(children, roots));
+    if (root)
+    {
+        _newTree(root);
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pair(
+    Node<V, K, Layout>* roots, Node<V, K, Layout>* children, MultipassPairing)
+{
+    Node<V, K, Layout>* root = _multipass(_concat(children, roots));
+    if (root)
+    {
+        _newTree(root);
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pair(
+    Node<V, K, Layout>* roots, Node<V, K, Layout>* children,
+    AuxiliaryTwoPassPairing)
+{
+    Node<V, K, Layout>* a = _twoPass(children);
+    Node<V, K, Layout>* b = _multipass(roots);
+
+    Node<V, K, Layout>* root = (a && b) ? _union(a, b) : (a ? a : b);
+    if (root)
+    {
+        _newTree(root);
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_decreaseKey(
+    Node<V, K, Layout>* handle, K key)
 {
     handle->key = key;
 
@@ -182,20 +470,494 @@ void PairingHeap<V, K>::_decreaseKey(Node<V, K>* handle, K key)
     }
     else
     {
-        if (key < minPtr->key)
+        statistics.comparison();
+        if (compare(key, minPtr->key))
         {
             minPtr = handle;
         }
     }
 }
 
-template<class V, class K>
-void PairingHeap<V, K>::_insertForest(Node<V, K>* other)
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_insertForest(
+    Node<V, K, Layout>* other)
 {
+    if (!other)
+    {
+        return;
+    }
+
+    if (!forest)
+    {
+        forest = other;
+
+        return;
+    }
+
     // insert other forest into heap
-    Node<V, K>* end = forest->left;
-    forest->left = other->left;
-    other->left->right = forest;
+    Node<V, K, Layout>* end = forest->left;
+    Node<V, K, Layout>* otherEnd = other->left;
+    forest->left = otherEnd;
+    otherEnd->right = forest;
     other->left = end;
     end->right = other;
-}
\ No newline at end of file
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+bool PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_unslot(
+    Node<V, K, Layout>* handle)
+{
+    for (std::uint64_t bits = occupied; bits; bits &= bits - 1)
+    {
+        int slot = lowestBit(bits);
+        if (slots[slot] == handle)
+        {
+            slots[slot] = NULL;
+            occupied &= ~(std::uint64_t(1) << slot);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_flushSlots()
+{
+    while (occupied)
+    {
+        int slot = lowestBit(occupied);
+        occupied &= occupied - 1;
+
+        _insertForest(slots[slot]);
+        slots[slot] = NULL;
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_consolidate(
+    int trees)
+{
+    // move trees from the front of the forest into the slots
+    std::uint64_t moved = 0;
+    while (trees > 0 && forest)
+    {
+        Node<V, K, Layout>* node = forest;
+        _removeRoot(node);
+
+        // link trees of equal slots until the slot of the survivor is free
+        int slot = 0;
+        while (occupied & (std::uint64_t(1) << slot))
+        {
+            node = _union(slots[slot], node);
+            slots[slot] = NULL;
+            occupied &= ~(std::uint64_t(1) << slot);
+            ++slot;
+        }
+
+        slots[slot] = node;
+        occupied |= std::uint64_t(1) << slot;
+
+        --trees;
+        ++moved;
+    }
+
+    if (moved)
+    {
+        statistics.consolidation(moved);
+    }
+
+    // ties may link the minimum below a root of equal key
+    while (minPtr && minPtr->parent)
+    {
+        minPtr = minPtr->parent;
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_findMin()
+{
+    minPtr = NULL;
+
+    if (forest)
+    {
+        Node<V, K, Layout>* node = forest;
+        do
+        {
+            statistics.comparison();
+            if (!minPtr || compare(node->key, minPtr->key))
+            {
+                minPtr = node;
+            }
+            node = node->right;
+        }
+        while (node != forest);
+    }
+
+    for (std::uint64_t bits = occupied; bits; bits &= bits - 1)
+    {
+        Node<V, K, Layout>* node = slots[lowestBit(bits)];
+
+        statistics.comparison();
+        if (!minPtr || compare(node->key, minPtr->key))
+        {
+            minPtr = node;
+        }
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::setBudget(
+    int budget)
+{
+    assert(budget >= 0);
+
+    /*
+     * pairing strategies expect all trees within the forest, whereas 
+     * deletions with a budget scan every tree left in the forest
+     */
+    if (!budget)
+    {
+        _flushSlots();
+    }
+    else
+    {
+        _consolidate(count);
+    }
+
+    this->budget = budget;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_buildTree(
+    std::vector<Node<V, K, Layout>*>& nodes)
+{
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    std::vector<Node<V, K, Layout>*> roots(nodes);
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        Node<V, K, Layout>* node = roots[i];
+
+        node->parent = NULL;
+        node->left = node;
+        node->right = node;
+        node->child = NULL;
+    }
+
+    // link pairs of trees until a single tree remains
+    std::size_t n = roots.size();
+    while (n > 1)
+    {
+        std::size_t survivors = 0;
+        for (std::size_t i = 0; i + 1 < n; i += 2)
+        {
+            roots[survivors++] = _union(roots[i], roots[i + 1]);
+        }
+
+        if (n % 2 == 1)
+        {
+            roots[survivors++] = roots[n - 1];
+        }
+
+        n = survivors;
+    }
+
+    _newTree(roots[0]);
+    count += static_cast<int>(nodes.size());
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+int PairingHeap<V, K, Compare, Pairing, Stats, Layout>::deleteMinBatch(
+    int k, std::vector<V>& out)
+{
+    _flushSlots();
+
+    if (k <= 0 || !forest)
+    {
+        return 0;
+    }
+
+    // move all roots into the auxiliary heap
+    candidates.clear();
+
+    Node<V, K, Layout>* current = forest;
+    forest->left->right = NULL;
+    while (current)
+    {
+        candidates.push_back(current);
+        current = current->right;
+    }
+
+    forest = NULL;
+    minPtr = NULL;
+
+    Greater greater = { compare };
+    std::make_heap(candidates.begin(), candidates.end(), greater);
+
+    int deleted = 0;
+    while (deleted < k && !candidates.empty())
+    {
+        std::pop_heap(candidates.begin(), candidates.end(), greater);
+        Node<V, K, Layout>* handle = candidates.back();
+        candidates.pop_back();
+
+        // children become candidates
+        if (handle->child)
+        {
+            Node<V, K, Layout>* child = handle->child;
+            Node<V, K, Layout>* node = child;
+            do
+            {
+                node->parent = NULL;
+                candidates.push_back(node);
+                std::push_heap(candidates.begin(), candidates.end(), greater);
+
+                node = node->right;
+            }
+            while (node != child);
+        }
+
+        out.push_back(std::move(handle->value.get()));
+        _free(handle);
+        ++deleted;
+    }
+
+    count -= deleted;
+
+    // link remaining candidates pair-wise until a single tree remains
+    std::size_t n = candidates.size();
+    while (n > 1)
+    {
+        std::size_t survivors = 0;
+        for (std::size_t i = 0; i + 1 < n; i += 2)
+        {
+            candidates[i]->left = candidates[i];
+            candidates[i]->right = candidates[i];
+            candidates[i + 1]->left = candidates[i + 1];
+            candidates[i + 1]->right = candidates[i + 1];
+
+            candidates[survivors++] = _union(candidates[i], candidates[i + 1]);
+        }
+
+        if (n % 2 == 1)
+        {
+            candidates[survivors++] = candidates[n - 1];
+        }
+
+        n = survivors;
+    }
+
+    if (n == 1)
+    {
+        _newTree(candidates[0]);
+    }
+    candidates.clear();
+
+    return deleted;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+template<class ValueIterator, class KeyIterator>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_insertBatch(
+    ValueIterator first, ValueIterator last,
+    KeyIterator keys, std::vector<Node<V, K, Layout>*>* handles)
+{
+    // slots[i] holds a tree of 2^i nodes
+    Node<V, K, Layout>* slots[64] = { NULL };
+    int n = 0;
+
+    for (; first != last; ++first, ++keys)
+    {
+        Node<V, K, Layout>* node = new (pool->allocate()) 
+            Node<V, K, Layout>(*keys, values, *first);
+
+        node->parent = NULL;
+        node->left = node;
+        node->right = node;
+        node->child = NULL;
+
+        if (handles)
+        {
+            handles->push_back(node);
+        }
+        ++n;
+
+        // link trees of equal size
+        int i = 0;
+        while (slots[i])
+        {
+            node = _union(slots[i], node);
+            slots[i] = NULL;
+            ++i;
+        }
+        slots[i] = node;
+    }
+
+    Node<V, K, Layout>* root = NULL;
+    for (int i = 0; i < 64; ++i)
+    {
+        if (slots[i])
+        {
+            root = root ? _union(root, slots[i]) : slots[i];
+        }
+    }
+
+    if (root)
+    {
+        _newTree(root);
+        count += n;
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+bool PairingHeap<V, K, Compare, Pairing, Stats, Layout>::save(const char* path)
+{
+    _flushSlots();
+
+    if (static_cast<std::uint64_t>(count) >= Snapshot::NIL)
+    {
+        return false;
+    }
+
+    std::vector<SnapshotNode<V, K>> nodes;
+    std::vector<Node<V, K, Layout>*> order;
+    nodes.reserve(count);
+    order.reserve(count);
+
+    std::uint32_t min = Snapshot::NIL;
+    if (forest)
+    {
+        _snapshotList(forest, Snapshot::NIL, nodes, order);
+
+        // the minimum is a root, hence among the nodes numbered so far
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (order[i] == minPtr)
+            {
+                min = static_cast<std::uint32_t>(i);
+            }
+        }
+
+        // append the children of every node, breadth-first
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (order[i]->child)
+            {
+                nodes[i].child = static_cast<std::uint32_t>(order.size());
+                _snapshotList(order[i]->child, static_cast<std::uint32_t>(i), 
+                    nodes, order);
+            }
+        }
+    }
+
+    return Snapshot::write(path, Snapshot::PAIRING, nodes, 
+        forest ? 0 : Snapshot::NIL, min);
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+void PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_snapshotList(
+    Node<V, K, Layout>* first, std::uint32_t parent, 
+    std::vector<SnapshotNode<V, K>>& nodes, 
+    std::vector<Node<V, K, Layout>*>& order)
+{
+    std::uint32_t begin = static_cast<std::uint32_t>(order.size());
+
+    Node<V, K, Layout>* node = first;
+    do
+    {
+        SnapshotNode<V, K> record;
+        std::memset(&record, 0, sizeof(record));
+
+        record.parent = parent;
+        record.child = Snapshot::NIL;
+        record.value = node->value.get();
+        record.key = node->key;
+
+        nodes.push_back(record);
+        order.push_back(node);
+
+        node = node->right;
+    }
+    while (node != first);
+
+    // siblings are consecutive, closing the circular list at both ends
+    std::uint32_t end = static_cast<std::uint32_t>(order.size());
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        nodes[i].left = (i == begin) ? end - 1 : i - 1;
+        nodes[i].right = (i + 1 == end) ? begin : i + 1;
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats, 
+    class Layout>
+bool PairingHeap<V, K, Compare, Pairing, Stats, Layout>::_load(
+    const char* path, std::vector<Node<V, K, Layout>*>* handles)
+{
+    SnapshotFile file(path);
+
+    const SnapshotNode<V, K>* records = 
+        file.nodes<V, K>(Snapshot::PAIRING);
+    if (!records)
+    {
+        return false;
+    }
+
+    clear();
+
+    const SnapshotHeader* header = file.header();
+    std::uint32_t n = static_cast<std::uint32_t>(header->count);
+
+    std::vector<Node<V, K, Layout>*> nodes;
+    pool->allocateBulk(n, nodes);
+
+    for (std::uint32_t i = 0; i < n; ++i)
+    {
+        const SnapshotNode<V, K>& record = records[i];
+
+        Node<V, K, Layout>* node = new (nodes[i]) 
+            Node<V, K, Layout>(record.key, values, record.value);
+
+        node->parent = (record.parent != Snapshot::NIL) 
+            ? nodes[record.parent] : NULL;
+        node->left = nodes[record.left];
+        node->right = nodes[record.right];
+        node->child = (record.child != Snapshot::NIL) 
+            ? nodes[record.child] : NULL;
+    }
+
+    if (n > 0)
+    {
+        forest = nodes[header->forest];
+        minPtr = nodes[header->minPtr];
+        count = static_cast<int>(n);
+    }
+
+    if (budget)
+    {
+        _consolidate(count);
+    }
+
+    if (handles)
+    {
+        handles->insert(handles->end(), nodes.begin(), nodes.end());
+    }
+
+    return true;
+}
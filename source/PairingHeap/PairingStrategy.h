@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * @brief Pairing strategy which buffers new trees and pairs them lazily.
+ *
+ * Insertions and cut subtrees are kept as separate trees in the forest.
+ * Deleting the minimum performs a single pass over all trees, linking
+ * consecutive pairs, and keeps the survivors as separate trees.
+ *
+ * Insertions and decreasing keys cost a single comparison with the minimum
+ * and no links, while deletions only perform half of the links of a
+ * complete pairing. This suits workloads with many insertions per deletion.
+ */
+struct LazyPairing
+{
+};
+
+/**
+ * @brief Pairing strategy which combines all trees by two-pass pairing.
+ *
+ * Deleting the minimum links consecutive pairs of all trees from left to
+ * right and afterwards links the survivors from right to left, such that a
+ * single tree remains. This is the classic pairing heap of Fredman et al.
+ * with lazily buffered insertions.
+ */
+struct TwoPassPairing
+{
+};
+
+/**
+ * @brief Pairing strategy which combines all trees by multipass pairing.
+ *
+ * Deleting the minimum links trees pair-wise in FIFO order: the result of
+ * every link is appended to the queue of remaining trees until a single tree
+ * remains. This yields more balanced trees than two-pass pairing.
+ */
+struct MultipassPairing
+{
+};
+
+/**
+ * @brief Pairing strategy with an auxiliary area for new trees.
+ *
+ * As proposed by Stasko and Vitter, the children of a deleted node are
+ * combined by two-pass pairing, whereas the auxiliary area of inserted trees
+ * and cut subtrees is combined by multipass pairing. Both results are linked
+ * to form a single tree.
+ *
+ * Deleting the minimum thus costs little for children, which tend to be
+ * sorted by key, while long runs of insertions are combined into balanced
+ * trees.
+ */
+struct AuxiliaryTwoPassPairing
+{
+};
@@ -0,0 +1,311 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../util/Bits.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+template<class V, class K> class RadixHeap;
+
+/**
+ * @brief Template for nodes of a radix heap.
+ *
+ * Radix heap nodes are linked into the doubly linked list of their bucket.
+ * They are associated with a key of type `K` and store some value of type
+ * `V`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct RNode : public INode<V, K>
+{
+public:
+    friend class RadixHeap<V, K>;
+
+    /**
+     * @brief Gets the value of the heap node.
+     *
+     * @return The value stored in the heap node
+     */
+    V getValue()
+    {
+        return value;
+    }
+
+    /**
+     * @brief Gets the key associated with the heap node.
+     *
+     * @return The key associated with the heap node
+     */
+    K getKey()
+    {
+        return key;
+    }
+
+private:
+    RNode* prev;
+    RNode* next;
+
+    V value;
+    K key;
+
+    int bucket;
+};
+
+/**
+ * @brief Template for radix heap data structures.
+ *
+ * Radix heaps are monotone priority queues for integer keys: every inserted
+ * or decreased key must not be smaller than the key most recently deleted.
+ *
+ * Bucket `0` holds the nodes whose key equals the last deleted key, bucket
+ * `i > 0` those whose key first differs from it in bit `i - 1`. Deleting
+ * the minimum redistributes the first non-empty bucket into smaller buckets,
+ * hence every node moves at most once per bit of the key type.
+ *
+ * This results in amortized \f$ O(\log C) \f$ time for deletions, where
+ * \f$ C \f$ is the largest difference between keys in the heap, and
+ * constant time for every other operation.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for integral key types of at most 64 bits
+ */
+template<class V, class K>
+class RadixHeap
+: public HeapBase<RadixHeap<V, K>, V, K, RNode<V, K>*>
+{
+    static_assert(std::is_integral<K>::value,
+        "RadixHeap requires integral keys");
+    static_assert(sizeof(K) <= sizeof(std::uint64_t),
+        "RadixHeap requires keys of at most 64 bits");
+
+private:
+    static const int BUCKETS = std::numeric_limits<std::uint64_t>::digits + 1;
+
+    RNode<V, K>* buckets[BUCKETS];
+    std::uint64_t occupied;
+    std::uint64_t last;
+    int count;
+
+    std::shared_ptr<NodePool<RNode<V, K>>> pool;
+
+public:
+    /**
+     * @brief Constructs a new radix heap with its own node pool.
+     *
+     */
+    RadixHeap()
+    : pool(std::make_shared<NodePool<RNode<V, K>>>())
+    {
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new radix heap allocating from a given pool.
+     *
+     * @param pool The node pool to allocate nodes from
+     */
+    explicit RadixHeap(std::shared_ptr<NodePool<RNode<V, K>>> pool)
+    : pool(pool)
+    {
+        assert(pool);
+
+        _init();
+    }
+
+    RadixHeap(const RadixHeap&) = delete;
+    RadixHeap& operator=(const RadixHeap&) = delete;
+
+    /**
+     * @brief Destroys the radix heap and all of its nodes.
+     *
+     */
+    ~RadixHeap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the radix heap.
+     *
+     * Afterwards, any key may be inserted again.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(n) \f$, as for the other heaps
+     */
+    void clear();
+
+    /**
+     * @brief Determines the current size of the radix heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the radix heap.
+     *
+     * The key must not be smaller than the last deleted key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return A pointer to the resulting heap node
+     */
+    RNode<V, K>* insert(V element, K key)
+    {
+        assert(_radix(key) >= last);
+
+        RNode<V, K>* node = new (pool->allocate()) RNode<V, K>;
+        node->value = element;
+        node->key = key;
+
+        _push(node);
+        ++count;
+
+        return node;
+    }
+
+    /**
+     * @brief Determines the value of the node with the smallest key.
+     *
+     * Runtime: \f$ O(\log C) \f$ amortized
+     *
+     * @return Value of the smallest element
+     */
+    V min()
+    {
+        assert(count > 0);
+
+        _refill();
+
+        return buckets[0]->value;
+    }
+
+    /**
+     * @brief Determines the smallest key.
+     *
+     * Runtime: \f$ O(\log C) \f$ amortized
+     *
+     * @return The smallest key
+     */
+    K minKey()
+    {
+        assert(count > 0);
+
+        _refill();
+
+        return buckets[0]->key;
+    }
+
+    /**
+     * @brief Deletes the heap node with smallest key and returns its value.
+     *
+     * Runtime: \f$ O(\log C) \f$ amortized
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(count > 0);
+
+        _refill();
+
+        return remove(buckets[0]);
+    }
+
+    /**
+     * @brief Removes a given node from the radix heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param handle Pointer to the node to remove
+     * @return Value of the deleted node
+     */
+    V remove(RNode<V, K>* handle)
+    {
+        V value = handle->value;
+
+        _unlink(handle);
+        _free(handle);
+        --count;
+
+        return value;
+    }
+
+    /**
+     * @brief Decreases the key of a given heap node.
+     *
+     * The new key must not be smaller than the last deleted key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param handle Pointer to the heap node
+     * @param key New key value of the heap node
+     */
+    void decreaseKey(RNode<V, K>* handle, K key)
+    {
+        if (key < handle->key)
+        {
+            assert(_radix(key) >= last);
+
+            _unlink(handle);
+            handle->key = key;
+            _push(handle);
+        }
+    }
+
+    /**
+     * @brief Merges two instances of radix heaps.
+     *
+     * Every node of `heap` is moved into the buckets of this heap, hence its
+     * keys must not be smaller than the last key deleted from this heap.
+     * Afterwards, `heap` is left empty.
+     *
+     * Runtime: \f$ O(m) \f$ for \f$ m \f$ nodes in `heap`
+     *
+     * @param heap Pointer to the radix heap to merge with
+     */
+    void merge(RadixHeap<V, K>* heap);
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     *
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<RNode<V, K>>> getPool()
+    {
+        return pool;
+    }
+
+private:
+    void _init();
+
+    void _free(RNode<V, K>* handle);
+
+    static std::uint64_t _radix(K key);
+
+    int _bucket(std::uint64_t radix);
+
+    void _push(RNode<V, K>* handle);
+
+    void _unlink(RNode<V, K>* handle);
+
+    void _refill();
+};
+
+#include "RadixHeap.hpp"
@@ -0,0 +1,180 @@
+template<class V, class K>
+const int RadixHeap<V, K>::BUCKETS;
+
+template<class V, class K>
+void RadixHeap<V, K>::_init()
+{
+    for (int i = 0; i < BUCKETS; ++i)
+    {
+        buckets[i] = NULL;
+    }
+
+    occupied = 0;
+    last = 0;
+    count = 0;
+}
+
+template<class V, class K>
+void RadixHeap<V, K>::clear()
+{
+    if (pool.use_count() == 1
+        && std::is_trivially_destructible<RNode<V, K>>::value)
+    {
+        pool->release();
+    }
+    else
+    {
+        for (int i = 0; i < BUCKETS; ++i)
+        {
+            RNode<V, K>* current = buckets[i];
+            while (current)
+            {
+                RNode<V, K>* node = current;
+                current = current->next;
+                _free(node);
+            }
+        }
+    }
+
+    _init();
+}
+
+template<class V, class K>
+void RadixHeap<V, K>::_free(RNode<V, K>* handle)
+{
+    handle->~RNode<V, K>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K>
+std::uint64_t RadixHeap<V, K>::_radix(K key)
+{
+    // flipping the sign bit preserves the order of signed keys
+    const std::uint64_t sign = std::is_signed<K>::value
+        ? std::uint64_t(1) << (std::numeric_limits<std::uint64_t>::digits - 1)
+        : 0;
+
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(key)) ^ sign;
+}
+
+template<class V, class K>
+int RadixHeap<V, K>::_bucket(std::uint64_t radix)
+{
+    return (radix == last) ? 0 : highestBit(radix ^ last) + 1;
+}
+
+template<class V, class K>
+void RadixHeap<V, K>::_push(RNode<V, K>* handle)
+{
+    int bucket = _bucket(_radix(handle->key));
+
+    handle->bucket = bucket;
+    handle->prev = NULL;
+    handle->next = buckets[bucket];
+    if (buckets[bucket])
+    {
+        buckets[bucket]->prev = handle;
+    }
+    buckets[bucket] = handle;
+
+    if (bucket > 0)
+    {
+        occupied |= std::uint64_t(1) << (bucket - 1);
+    }
+}
+
+template<class V, class K>
+void RadixHeap<V, K>::_unlink(RNode<V, K>* handle)
+{
+    int bucket = handle->bucket;
+
+    if (handle->prev)
+    {
+        handle->prev->next = handle->next;
+    }
+    else
+    {
+        buckets[bucket] = handle->next;
+    }
+
+    if (handle->next)
+    {
+        handle->next->prev = handle->prev;
+    }
+
+    if (bucket > 0 && !buckets[bucket])
+    {
+        occupied &= ~(std::uint64_t(1) << (bucket - 1));
+    }
+}
+
+template<class V, class K>
+void RadixHeap<V, K>::_refill()
+{
+    if (buckets[0])
+    {
+        return;
+    }
+
+    // find the smallest key within the first non-empty bucket
+    int bucket = lowestBit(occupied) + 1;
+
+    RNode<V, K>* min = buckets[bucket];
+    for (RNode<V, K>* node = min->next; node; node = node->next)
+    {
+        if (node->key < min->key)
+        {
+            min = node;
+        }
+    }
+
+    // redistribute the bucket, every node moves to a smaller bucket
+    RNode<V, K>* current = buckets[bucket];
+    buckets[bucket] = NULL;
+    occupied &= ~(std::uint64_t(1) << (bucket - 1));
+    last = _radix(min->key);
+
+    while (current)
+    {
+        RNode<V, K>* node = current;
+        current = current->next;
+        _push(node);
+    }
+}
+
+template<class V, class K>
+void RadixHeap<V, K>::merge(RadixHeap<V, K>* heap)
+{
+    if (heap == this || heap->count == 0)
+    {
+        return;
+    }
+
+    if (heap->pool != pool)
+    {
+        if (heap->pool.use_count() == 1)
+        {
+            pool->splice(*heap->pool);
+        }
+        else
+        {
+            pool->retain(heap->pool);
+        }
+    }
+
+    for (int i = 0; i < BUCKETS; ++i)
+    {
+        RNode<V, K>* current = heap->buckets[i];
+        while (current)
+        {
+            RNode<V, K>* node = current;
+            current = current->next;
+
+            assert(_radix(node->key) >= last);
+            _push(node);
+        }
+    }
+
+    count += heap->count;
+    heap->_init();
+}
@@ -0,0 +1,436 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../util/Bits.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+template<class V, class K, int Type> class RankPairingHeap;
+
+/**
+ * @brief Template for nodes of a rank-pairing heap.
+ *
+ * Rank-pairing heap nodes form half trees, i.e. binary trees whose roots
+ * have no right child. Every node maintains pointers to its parent node, its
+ * left and its right child. The right pointer of a root links it to the next
+ * root of the heap instead.
+ *
+ * They are associated with a key of type `K` and store some value of type `V`.
+ * Furthermore, they maintain a rank.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+struct RPNode : public INode<V, K>
+{
+public:
+    template<class, class, int> friend class RankPairingHeap;
+
+    /**
+     * @brief Get the parent node.
+     *
+     * @return A pointer to the parent node
+     */
+    RPNode<V, K>* getParent()
+    {
+        return parent;
+    }
+
+    /**
+     * @brief Gets the left child node.
+     *
+     * @return A pointer to the left child node
+     */
+    RPNode<V, K>* getLeft()
+    {
+        return left;
+    }
+
+    /**
+     * @brief Gets the right child node or, for roots, the next root.
+     *
+     * @return A pointer to the right child node or the next root
+     */
+    RPNode<V, K>* getRight()
+    {
+        return right;
+    }
+
+    /**
+     * @brief Gets the value of the heap node.
+     *
+     * @return The value stored in the heap node
+     */
+    V getValue()
+    {
+        return value;
+    }
+
+    /**
+     * @brief Gets the key associated with the heap node.
+     *
+     * @return The key associated with the heap node
+     */
+    K getKey()
+    {
+        return key;
+    }
+
+    /**
+     * @brief Get the rank associated with the heap node.
+     *
+     * @return The rank of the heap node.
+     */
+    int getRank()
+    {
+        return rank;
+    }
+
+    bool hasChildren()
+    {
+        return left || (parent && right);
+    }
+
+    bool hasParent()
+    {
+        return parent;
+    }
+
+private:
+    RPNode* parent;
+    RPNode* left;
+    RPNode* right;
+
+    V value;
+    K key;
+
+    int rank;
+};
+
+/**
+ * @brief Template for rank-pairing heap data structures.
+ *
+ * Rank-pairing heaps, as proposed by Haeupler, Sen and Tarjan, maintain a
+ * circular list of half-ordered half trees: every node has a key not larger
+ * than the keys within its left subtree. Trees of equal rank are linked in a
+ * single pass when deleting the minimum.
+ *
+ * Instead of cascading cuts and marks, decreasing a key cuts a single
+ * subtree and restores the rank rule by walking up the ancestors whose
+ * rank shrinks. With children of ranks \f$ r_1 \f$ and \f$ r_2 \f$, missing
+ * children having rank \f$ -1 \f$, a node has rank
+ *
+ * - type 1: \f$ \max(r_1, r_2) \f$ if \f$ r_1 \neq r_2 \f$,
+ *   \f$ r_1 + 1 \f$ otherwise,
+ * - type 2: \f$ \max(r_1, r_2) \f$ if \f$ |r_1 - r_2| > 1 \f$,
+ *   \f$ \max(r_1, r_2) + 1 \f$ otherwise.
+ *
+ * Roots always have a rank one larger than their left child. Type 2 allows
+ * larger rank differences, hence decreasing keys changes fewer ranks.
+ *
+ * This results in the amortized bounds of Fibonacci heaps: logarithmic time
+ * for deletions and constant time for every other operation.
+ *
+ * All operations are statically dispatched. Use `HeapAdapter` to access the
+ * heap through `IHeap`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @tparam Type Template parameter for the rank rule, either 1 or 2
+ */
+template<class V, class K, int Type = 2>
+class RankPairingHeap
+: public HeapBase<RankPairingHeap<V, K, Type>, V, K, RPNode<V, K>*>
+{
+    static_assert(Type == 1 || Type == 2,
+        "RankPairingHeap requires rank rule type 1 or 2");
+
+private:
+    /*
+     * a node of rank r has at least phi^r descendants, hence ranks are
+     * bounded by log_phi(n) < 1.45 log_2(n) for any count
+     */
+    static const int RANKS = std::numeric_limits<int>::digits * 3 / 2 + 2;
+
+    static_assert(RANKS <= std::numeric_limits<std::uint64_t>::digits,
+        "rank table must be indexable by a 64 bit mask");
+
+    RPNode<V, K>* forest;
+    RPNode<V, K>* minPtr;
+    int count;
+
+    // rank table of _deleteRoot, empty between deletions
+    RPNode<V, K>* ranks[RANKS];
+    std::uint64_t occupied;
+
+    std::shared_ptr<NodePool<RPNode<V, K>>> pool;
+
+public:
+    /**
+     * @brief Constructs a new rank-pairing heap with its own node pool.
+     *
+     */
+    RankPairingHeap()
+    : pool(std::make_shared<NodePool<RPNode<V, K>>>())
+    {
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new rank-pairing heap allocating from a given pool.
+     *
+     * Heaps that are going to be merged should share one pool, such that
+     * merging does not need to transfer or retain any slabs.
+     *
+     * @param pool The node pool to allocate nodes from
+     */
+    explicit RankPairingHeap(std::shared_ptr<NodePool<RPNode<V, K>>> pool)
+    : pool(pool)
+    {
+        assert(pool);
+
+        _init();
+    }
+
+    RankPairingHeap(const RankPairingHeap&) = delete;
+    RankPairingHeap& operator=(const RankPairingHeap&) = delete;
+
+    /**
+     * @brief Destroys the rank-pairing heap.
+     *
+     * Deletes all nodes of all trees maintained by the heap.
+     *
+     */
+    ~RankPairingHeap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the rank-pairing heap.
+     *
+     * If the heap is the only user of its node pool and nodes are trivially
+     * destructible, all slabs are released at once. Otherwise, every node is
+     * destroyed and returned to the pool separately.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(n) \f$, respectively
+     */
+    void clear()
+    {
+        if (pool.use_count() == 1
+            && std::is_trivially_destructible<RPNode<V, K>>::value)
+        {
+            pool->release();
+        }
+        else if (forest)
+        {
+            _deleteAll();
+        }
+
+        _init();
+    }
+
+    /**
+     * @brief Determines the current size of the rank-pairing heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the rank-pairing heap.
+     *
+     * The new node forms a half tree of rank zero within the root list.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return A pointer to the resulting heap node
+     */
+    RPNode<V, K>* insert(V element, K key)
+    {
+        RPNode<V, K>* node = new (pool->allocate()) RPNode<V, K>;
+
+        node->left = NULL;
+        node->value = element;
+        node->key = key;
+        node->rank = 0;
+
+        _newTree(node);
+        ++count;
+
+        return node;
+    }
+
+    /**
+     * @brief Determines the value of the node with the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return Value of the smallest element
+     */
+    V min()
+    {
+        assert(minPtr);
+
+        return minPtr->value;
+    }
+
+    /**
+     * @brief Deletes the heap node with smallest key and returns its value.
+     *
+     * The right spine of the left subtree of the minimum falls apart into new
+     * half trees. Together with all other roots, they are linked by rank in
+     * a single pass.
+     *
+     * Runtime: \f$ O(\log n) \f$ amortized
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(minPtr);
+
+        V value = minPtr->value;
+
+        _deleteRoot(minPtr);
+
+        return value;
+    }
+
+    /**
+     * @brief Removes a given node from the rank-pairing heap.
+     *
+     * The half tree rooted at the node is cut from its tree and the node is
+     * deleted as a root, without touching its key.
+     *
+     * Runtime: \f$ O(\log n) \f$ amortized
+     *
+     * @param handle Pointer to the node to remove
+     * @return Value of the deleted node
+     */
+    V remove(RPNode<V, K>* handle)
+    {
+        V value = handle->value;
+
+        if (handle->parent)
+        {
+            _cut(handle);
+        }
+
+        _deleteRoot(handle);
+
+        return value;
+    }
+
+    /**
+     * @brief Decreases the key of a given heap node.
+     *
+     * A node which is not a root is cut together with its left subtree and
+     * replaced by its right subtree. Afterwards, ranks of its former
+     * ancestors are reduced until the rank rule holds again.
+     *
+     * Runtime: \f$ O(1) \f$ amortized
+     *
+     * @param handle Pointer to the heap node
+     * @param key New key value of the heap node
+     */
+    void decreaseKey(RPNode<V, K>* handle, K key)
+    {
+        if (!(key < handle->key))
+        {
+            return;
+        }
+
+        handle->key = key;
+
+        if (handle->parent)
+        {
+            _cut(handle);
+        }
+        else if (key < minPtr->key)
+        {
+            minPtr = handle;
+        }
+    }
+
+    /**
+     * @brief Merges two instances of rank-pairing heaps.
+     *
+     * Both root lists are concatenated and `heap` is left empty. Node pools
+     * are transferred or retained as for the other heaps.
+     *
+     * Runtime: \f$ O(1) \f$ for shared pools
+     *
+     * @param heap Pointer to the rank-pairing heap to merge with
+     */
+    void merge(RankPairingHeap<V, K, Type>* heap);
+
+    /**
+     * @brief Gets the root list.
+     *
+     * @return A pointer to one root of the heap
+     */
+    RPNode<V, K>* getForest()
+    {
+        return forest;
+    }
+
+    /**
+     * @brief Gets the node with the smallest key.
+     *
+     * @return A pointer to the smallest element
+     */
+    RPNode<V, K>* getMinPtr()
+    {
+        return minPtr;
+    }
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     *
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<RPNode<V, K>>> getPool()
+    {
+        return pool;
+    }
+
+private:
+    void _init();
+
+    void _deleteAll();
+
+    void _free(RPNode<V, K>* handle);
+
+    static int _rank(RPNode<V, K>* handle);
+
+    static int _rankRule(RPNode<V, K>* handle);
+
+    void _newTree(RPNode<V, K>* handle);
+
+    RPNode<V, K>* _link(RPNode<V, K>* a, RPNode<V, K>* b);
+
+    void _cut(RPNode<V, K>* handle);
+
+    void _insertByRank(RPNode<V, K>* handle);
+
+    void _deleteRoot(RPNode<V, K>* handle);
+};
+
+#include "RankPairingHeap.hpp"
@@ -0,0 +1,270 @@
+template<class V, class K, int Type>
+const int RankPairingHeap<V, K, Type>::RANKS;
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_init()
+{
+    forest = NULL;
+    minPtr = NULL;
+    count = 0;
+
+    for (int i = 0; i < RANKS; ++i)
+    {
+        ranks[i] = NULL;
+    }
+    occupied = 0;
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_deleteAll()
+{
+    // open the root list, which then forms the right spine of all nodes
+    RPNode<V, K>* current = forest->right;
+    forest->right = NULL;
+
+    while (current)
+    {
+        // rotate left children onto the spine until the current node is free
+        if (current->left)
+        {
+            RPNode<V, K>* child = current->left;
+            current->left = child->right;
+            child->right = current;
+            current = child;
+        }
+        else
+        {
+            RPNode<V, K>* node = current;
+            current = current->right;
+            _free(node);
+        }
+    }
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_free(RPNode<V, K>* handle)
+{
+    handle->~RPNode<V, K>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K, int Type>
+int RankPairingHeap<V, K, Type>::_rank(RPNode<V, K>* handle)
+{
+    return handle ? handle->rank : -1;
+}
+
+template<class V, class K, int Type>
+int RankPairingHeap<V, K, Type>::_rankRule(RPNode<V, K>* handle)
+{
+    int a = _rank(handle->left);
+    int b = _rank(handle->right);
+    int max = (a < b) ? b : a;
+
+    if (Type == 1)
+    {
+        return (a == b) ? a + 1 : max;
+    }
+
+    return (a - b > 1 || b - a > 1) ? max : max + 1;
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_newTree(RPNode<V, K>* handle)
+{
+    handle->parent = NULL;
+
+    if (!forest)
+    {
+        handle->right = handle;
+        forest = handle;
+        minPtr = handle;
+
+        return;
+    }
+
+    // insert handle behind the first root
+    handle->right = forest->right;
+    forest->right = handle;
+
+    if (handle->key < minPtr->key)
+    {
+        minPtr = handle;
+    }
+}
+
+template<class V, class K, int Type>
+RPNode<V, K>* RankPairingHeap<V, K, Type>::_link(
+    RPNode<V, K>* a, RPNode<V, K>* b)
+{
+    if (b->key < a->key)
+    {
+        RPNode<V, K>* swap = a;
+        a = b;
+        b = swap;
+    }
+
+    // b becomes the left child of a, taking the left subtree of a as right
+    b->right = a->left;
+    if (b->right)
+    {
+        b->right->parent = b;
+    }
+
+    b->parent = a;
+    a->left = b;
+
+    // increment rank of surviving root
+    (a->rank)++;
+
+    return a;
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_cut(RPNode<V, K>* handle)
+{
+    RPNode<V, K>* parent = handle->parent;
+
+    // replace handle by its right subtree
+    RPNode<V, K>* right = handle->right;
+    if (parent->left == handle)
+    {
+        parent->left = right;
+    }
+    else
+    {
+        parent->right = right;
+    }
+
+    if (right)
+    {
+        right->parent = parent;
+    }
+
+    handle->rank = _rank(handle->left) + 1;
+    _newTree(handle);
+
+    // reduce ranks of ancestors until the rank rule holds again
+    RPNode<V, K>* current = parent;
+    while (current->parent)
+    {
+        int rank = _rankRule(current);
+        if (rank >= current->rank)
+        {
+            return;
+        }
+
+        current->rank = rank;
+        current = current->parent;
+    }
+
+    current->rank = _rank(current->left) + 1;
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_insertByRank(RPNode<V, K>* handle)
+{
+    int rank = handle->rank;
+    assert(rank < RANKS);
+
+    RPNode<V, K>* collision = ranks[rank];
+    if (!collision)
+    {
+        ranks[rank] = handle;
+        occupied |= std::uint64_t(1) << rank;
+
+        return;
+    }
+
+    // link only once per pass, the result becomes a root immediately
+    ranks[rank] = NULL;
+    occupied &= ~(std::uint64_t(1) << rank);
+
+    _newTree(_link(collision, handle));
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::_deleteRoot(RPNode<V, K>* handle)
+{
+    // detach all other roots
+    RPNode<V, K>* current = handle->right;
+
+    forest = NULL;
+    minPtr = NULL;
+
+    while (current != handle)
+    {
+        RPNode<V, K>* node = current;
+        current = current->right;
+
+        _insertByRank(node);
+    }
+
+    // the right spine of the left subtree falls apart into half trees
+    current = handle->left;
+    while (current)
+    {
+        RPNode<V, K>* node = current;
+        current = current->right;
+
+        node->parent = NULL;
+        node->rank = _rank(node->left) + 1;
+
+        _insertByRank(node);
+    }
+
+    _free(handle);
+    --count;
+
+    // remaining half trees become roots and the rank table is emptied
+    while (occupied)
+    {
+        int rank = lowestBit(occupied);
+        occupied &= occupied - 1;
+
+        _newTree(ranks[rank]);
+        ranks[rank] = NULL;
+    }
+}
+
+template<class V, class K, int Type>
+void RankPairingHeap<V, K, Type>::merge(RankPairingHeap<V, K, Type>* heap)
+{
+    if (heap == this || !heap->forest)
+    {
+        return;
+    }
+
+    if (heap->pool != pool)
+    {
+        if (heap->pool.use_count() == 1)
+        {
+            pool->splice(*heap->pool);
+        }
+        else
+        {
+            pool->retain(heap->pool);
+        }
+    }
+
+    if (!forest)
+    {
+        forest = heap->forest;
+        minPtr = heap->minPtr;
+    }
+    else
+    {
+        // exchanging successors concatenates both circular lists
+        RPNode<V, K>* next = forest->right;
+        forest->right = heap->forest->right;
+        heap->forest->right = next;
+
+        if (heap->minPtr->key < minPtr->key)
+        {
+            minPtr = heap->minPtr;
+        }
+    }
+
+    count += heap->count;
+    heap->_init();
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Template for external-memory priority queues.
+ *
+ * Sequence heaps as proposed by Sanders keep only a small part of their
+ * elements in memory: new elements go to an insertion heap of `runSize`
+ * elements. Once it is full, it is sorted and spilled to a file as a sorted
+ * run. Runs are organized in groups of at most `degree` runs, where a full
+ * group is merged into a single run of the next group by a `degree`-way
+ * merge. Hence, every element is written and read
+ * \f$ O(\log_{degree}(n / runSize)) \f$ times.
+ *
+ * Deleting the minimum compares the smallest element of the insertion heap
+ * with the smallest head of all runs, which are kept in a small heap of
+ * runs. Files are only ever read and written sequentially through buffers of
+ * `bufferSize` elements, and exhausted runs are deleted right away.
+ *
+ * Run files are anonymous temporary files: within `directory` on POSIX
+ * systems, if given, and within the temporary directory of the system
+ * otherwise. They disappear once closed, even if the process is killed.
+ *
+ * Like MultiQueues, sequence heaps do not hand out handles, hence they offer
+ * `insert`, `min`, `deleteMin` and `size` only.
+ *
+ * @tparam V Template parameter for trivially copyable value types
+ * @tparam K Template parameter for trivially copyable key types
+ * @tparam Compare Template parameter for the strict weak ordering of keys,
+ * the heap maintains the smallest key with respect to it
+ */
+template<class V, class K, class Compare = std::less<K>>
+class SequenceHeap
+{
+    static_assert(std::is_trivially_copyable<V>::value
+        && std::is_trivially_copyable<K>::value,
+        "SequenceHeap requires trivially copyable values and keys");
+
+private:
+    struct Entry
+    {
+        K key;
+        V value;
+    };
+
+    struct Run
+    {
+        std::FILE* file;
+        std::size_t group;
+
+        // entries not read from the file yet
+        std::uint64_t remaining;
+
+        // entries read from the file, starting at position
+        std::vector<Entry> buffer;
+        std::size_t position;
+    };
+
+    // orders entries and runs by descending keys for the std heap algorithms
+    struct Greater
+    {
+        Compare compare;
+
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            return compare(b.key, a.key);
+        }
+
+        bool operator()(const Run* a, const Run* b) const
+        {
+            return compare(b->buffer[b->position].key,
+                a->buffer[a->position].key);
+        }
+    };
+
+    std::vector<Entry> insertion;
+
+    std::vector<std::vector<Run*>> groups;
+
+    // all runs, ordered by their smallest entry
+    std::vector<Run*> heads;
+
+    std::size_t runSize;
+    std::size_t degree;
+    std::size_t bufferSize;
+    std::string directory;
+
+    std::uint64_t count;
+    std::uint64_t bytesRead;
+    std::uint64_t bytesWritten;
+
+    Greater greater;
+
+public:
+    /**
+     * @brief Constructs a new sequence heap.
+     *
+     * The heap keeps up to `runSize` elements in its insertion heap and
+     * `bufferSize` elements per run in memory.
+     *
+     * @param runSize Number of elements of the insertion heap
+     * @param degree Maximum number of runs per group
+     * @param bufferSize Number of elements per buffer of a run
+     * @param directory Directory of run files, empty for the temporary
+     * directory of the system
+     * @param compare The ordering of keys
+     */
+    explicit SequenceHeap(std::size_t runSize = 1 << 20,
+        std::size_t degree = 64, std::size_t bufferSize = 1 << 12,
+        const std::string& directory = std::string(),
+        const Compare& compare = Compare())
+    : runSize(runSize), degree(degree), bufferSize(bufferSize),
+      directory(directory), count(0), bytesRead(0), bytesWritten(0)
+    {
+        assert(runSize > 0);
+        assert(degree > 1);
+        assert(bufferSize > 0);
+
+        greater.compare = compare;
+    }
+
+    SequenceHeap(const SequenceHeap&) = delete;
+    SequenceHeap& operator=(const SequenceHeap&) = delete;
+
+    /**
+     * @brief Destroys the sequence heap and deletes all run files.
+     *
+     */
+    ~SequenceHeap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all elements and run files of the sequence heap.
+     *
+     * The I/O counters are kept.
+     *
+     * Runtime: \f$ O(r) \f$ for \f$ r \f$ runs
+     */
+    void clear();
+
+    /**
+     * @brief Determines the current size of the sequence heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    std::uint64_t size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Checks whether the sequence heap is empty.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return true if the heap contains no elements, false otherwise
+     */
+    bool empty()
+    {
+        return count == 0;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the sequence heap.
+     *
+     * If the insertion heap is full, it is spilled as a new run first.
+     *
+     * Runtime: \f$ O(\log m + \frac{1}{B} \log_k \frac{n}{m}) \f$ amortized
+     * I/Os for runs of \f$ m \f$ elements, buffers of \f$ B \f$ elements and
+     * degree \f$ k \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @throws std::runtime_error if a run file cannot be created or written
+     */
+    void insert(const V& element, const K& key)
+    {
+        if (insertion.size() >= runSize)
+        {
+            _spill();
+        }
+
+        Entry entry;
+        entry.key = key;
+        entry.value = element;
+
+        insertion.push_back(entry);
+        std::push_heap(insertion.begin(), insertion.end(), greater);
+
+        ++count;
+    }
+
+    /**
+     * @brief Determines the value of the element with the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return A reference to the value of the smallest element, valid until
+     * the next insertion or deletion
+     */
+    const V& min()
+    {
+        assert(count > 0);
+
+        return _fromRuns()
+            ? heads.front()->buffer[heads.front()->position].value
+            : insertion.front().value;
+    }
+
+    /**
+     * @brief Deletes the element with smallest key and returns its value.
+     *
+     * Runtime: \f$ O(\log m + \log r) \f$ and \f$ O(\frac{1}{B}) \f$
+     * amortized I/Os for \f$ r \f$ runs
+     *
+     * @return The value of the smallest element
+     * @throws std::runtime_error if a run file cannot be read
+     */
+    V deleteMin();
+
+    /**
+     * @brief Gets the number of bytes read from run files so far.
+     *
+     * @return The number of bytes read
+     */
+    std::uint64_t getBytesRead()
+    {
+        return bytesRead;
+    }
+
+    /**
+     * @brief Gets the number of bytes written to run files so far.
+     *
+     * @return The number of bytes written
+     */
+    std::uint64_t getBytesWritten()
+    {
+        return bytesWritten;
+    }
+
+    /**
+     * @brief Determines the number of runs currently stored in files.
+     *
+     * @return The number of runs
+     */
+    std::size_t getRuns()
+    {
+        return heads.size();
+    }
+
+private:
+    bool _fromRuns();
+
+    void _spill();
+
+    void _merge(std::size_t group);
+
+    void _rebuildHeads();
+
+    Run* _createRun(std::size_t group);
+
+    void _destroyRun(Run* run);
+
+    void _removeRun(Run* run);
+
+    void _write(Run* run, const std::vector<Entry>& entries);
+
+    void _rewind(Run* run, std::uint64_t entries);
+
+    bool _advance(Run* run);
+};
+
+#include "SequenceHeap.hpp"
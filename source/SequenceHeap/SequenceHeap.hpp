@@ -0,0 +1,280 @@
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::clear()
+{
+    for (const std::vector<Run*>& runs : groups)
+    {
+        for (Run* run : runs)
+        {
+            _destroyRun(run);
+        }
+    }
+
+    heads.clear();
+    groups.clear();
+    insertion.clear();
+    count = 0;
+}
+
+template<class V, class K, class Compare>
+V SequenceHeap<V, K, Compare>::deleteMin()
+{
+    assert(count > 0);
+
+    --count;
+
+    if (_fromRuns())
+    {
+        Run* run = heads.front();
+        std::pop_heap(heads.begin(), heads.end(), greater);
+
+        V value = run->buffer[run->position++].value;
+        if (_advance(run))
+        {
+            std::push_heap(heads.begin(), heads.end(), greater);
+        }
+        else
+        {
+            heads.pop_back();
+            _removeRun(run);
+        }
+
+        return value;
+    }
+
+    std::pop_heap(insertion.begin(), insertion.end(), greater);
+    V value = insertion.back().value;
+    insertion.pop_back();
+
+    return value;
+}
+
+template<class V, class K, class Compare>
+bool SequenceHeap<V, K, Compare>::_fromRuns()
+{
+    if (heads.empty())
+    {
+        return false;
+    }
+
+    if (insertion.empty())
+    {
+        return true;
+    }
+
+    // prefer the insertion heap on ties, it is cheaper to delete from
+    return greater(insertion.front(),
+        heads.front()->buffer[heads.front()->position]);
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_spill()
+{
+    // the reverse of a heap ordered by greater keys sorts ascendingly
+    std::sort_heap(insertion.begin(), insertion.end(), greater);
+    std::reverse(insertion.begin(), insertion.end());
+
+    Run* run = _createRun(0);
+    _write(run, insertion);
+    _rewind(run, insertion.size());
+    insertion.clear();
+
+    if (groups.empty())
+    {
+        groups.emplace_back();
+    }
+    groups[0].push_back(run);
+
+    // cascade merges of full groups
+    for (std::size_t group = 0; group < groups.size()
+        && groups[group].size() >= degree; ++group)
+    {
+        _merge(group);
+    }
+
+    _rebuildHeads();
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_merge(std::size_t group)
+{
+    std::vector<Run*> runs;
+    runs.swap(groups[group]);
+
+    if (groups.size() == group + 1)
+    {
+        groups.emplace_back();
+    }
+
+    Run* merged = _createRun(group + 1);
+    std::uint64_t total = 0;
+
+    std::vector<Entry> output;
+    output.reserve(bufferSize);
+
+    std::make_heap(runs.begin(), runs.end(), greater);
+    while (!runs.empty())
+    {
+        Run* run = runs.front();
+        std::pop_heap(runs.begin(), runs.end(), greater);
+
+        output.push_back(run->buffer[run->position++]);
+        if (output.size() == bufferSize)
+        {
+            _write(merged, output);
+            total += output.size();
+            output.clear();
+        }
+
+        if (_advance(run))
+        {
+            std::push_heap(runs.begin(), runs.end(), greater);
+        }
+        else
+        {
+            runs.pop_back();
+            _destroyRun(run);
+        }
+    }
+
+    _write(merged, output);
+    total += output.size();
+
+    _rewind(merged, total);
+    groups[group + 1].push_back(merged);
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_rebuildHeads()
+{
+    heads.clear();
+    for (const std::vector<Run*>& runs : groups)
+    {
+        heads.insert(heads.end(), runs.begin(), runs.end());
+    }
+
+    std::make_heap(heads.begin(), heads.end(), greater);
+}
+
+template<class V, class K, class Compare>
+typename SequenceHeap<V, K, Compare>::Run*
+SequenceHeap<V, K, Compare>::_createRun(std::size_t group)
+{
+    std::FILE* file = NULL;
+
+#if defined(__unix__)
+    if (!directory.empty())
+    {
+        std::string path = directory + "/sequence-heap-XXXXXX";
+        int fd = mkstemp(&path[0]);
+        if (fd >= 0)
+        {
+            // the file lives as long as it is open
+            unlink(path.c_str());
+
+            file = fdopen(fd, "w+b");
+            if (!file)
+            {
+                close(fd);
+            }
+        }
+    }
+    else
+#endif
+    {
+        file = std::tmpfile();
+    }
+
+    if (!file)
+    {
+        throw std::runtime_error("SequenceHeap: cannot create run file");
+    }
+
+    // runs are read and written through buffers of the heap
+    std::setvbuf(file, NULL, _IONBF, 0);
+
+    Run* run = new Run;
+    run->file = file;
+    run->group = group;
+    run->remaining = 0;
+    run->position = 0;
+
+    return run;
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_destroyRun(Run* run)
+{
+    std::fclose(run->file);
+    delete run;
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_removeRun(Run* run)
+{
+    std::vector<Run*>& runs = groups[run->group];
+    runs.erase(std::find(runs.begin(), runs.end(), run));
+
+    _destroyRun(run);
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_write(Run* run,
+    const std::vector<Entry>& entries)
+{
+    if (entries.empty())
+    {
+        return;
+    }
+
+    if (std::fwrite(entries.data(), sizeof(Entry), entries.size(), run->file)
+        != entries.size())
+    {
+        throw std::runtime_error("SequenceHeap: cannot write run file");
+    }
+
+    bytesWritten += entries.size() * sizeof(Entry);
+}
+
+template<class V, class K, class Compare>
+void SequenceHeap<V, K, Compare>::_rewind(Run* run, std::uint64_t entries)
+{
+    if (std::fseek(run->file, 0, SEEK_SET) != 0)
+    {
+        throw std::runtime_error("SequenceHeap: cannot rewind run file");
+    }
+
+    run->remaining = entries;
+    run->buffer.clear();
+    run->position = 0;
+
+    _advance(run);
+}
+
+template<class V, class K, class Compare>
+bool SequenceHeap<V, K, Compare>::_advance(Run* run)
+{
+    if (run->position < run->buffer.size())
+    {
+        return true;
+    }
+
+    if (run->remaining == 0)
+    {
+        return false;
+    }
+
+    std::size_t n = run->remaining < bufferSize
+        ? static_cast<std::size_t>(run->remaining) : bufferSize;
+
+    run->buffer.resize(n);
+    if (std::fread(run->buffer.data(), sizeof(Entry), n, run->file) != n)
+    {
+        throw std::runtime_error("SequenceHeap: cannot read run file");
+    }
+
+    bytesRead += n * sizeof(Entry);
+    run->remaining -= n;
+    run->position = 0;
+
+    return true;
+}
@@ -0,0 +1,460 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+#include "../interface/INode.h"
+#include "../memory/NodePool.h"
+#include "../memory/ValueLayout.h"
+#include "../util/HeapStats.h"
+#include "../PairingHeap/PairingStrategy.h"
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<class V, class K, class Compare = std::less<K>,
+    class Pairing = TwoPassPairing, class Stats = NoStats,
+    class Layout = InlineValues>
+class SlimPairingHeap;
+
+/**
+ * @brief Template for nodes of a slim pairing heap.
+ *
+ * Slim pairing heap nodes maintain three pointers only: one to their
+ * leftmost child, one to their right sibling and one to their left sibling.
+ * The leftmost child of a node has no left sibling and points to its parent
+ * instead, and a root points to neither.
+ *
+ * They are associated with a key of type `K` and store some value of type `V`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @tparam Layout Template parameter for the node layout, either
+ * `InlineValues` or `SplitValues`
+ */
+template<class V, class K, class Layout = InlineValues>
+struct SPNode : public INode<V, K>
+{
+public:
+    template<class, class, class, class, class, class>
+    friend class SlimPairingHeap;
+
+    /**
+     * @brief Gets the leftmost child node.
+     *
+     * @return A pointer to the leftmost child node
+     */
+    SPNode* getChild()
+    {
+        return child;
+    }
+
+    /**
+     * @brief Gets the right sibling node.
+     *
+     * @return A pointer to the right sibling node
+     */
+    SPNode* getNext()
+    {
+        return next;
+    }
+
+    /**
+     * @brief Gets the left sibling node, or the parent node of a leftmost
+     * child.
+     *
+     * @return A pointer to the left sibling or parent node
+     */
+    SPNode* getPrev()
+    {
+        return prev;
+    }
+
+    /**
+     * @brief Gets the value of the heap node.
+     *
+     * @return The value stored in the heap node
+     */
+    V getValue()
+    {
+        return value.get();
+    }
+
+    /**
+     * @brief Gets the key associated with the heap node.
+     *
+     * @return The key associated with the heap node
+     */
+    K getKey()
+    {
+        return key;
+    }
+
+    bool hasChildren()
+    {
+        return child;
+    }
+
+    bool hasParent()
+    {
+        return prev;
+    }
+
+private:
+    template<class... Args>
+    SPNode(K key, typename Layout::template Store<V>& store, Args&&... args)
+    : value(store, std::forward<Args>(args)...), key(std::move(key))
+    {
+    }
+
+    SPNode* child;
+    SPNode* next;
+    SPNode* prev;
+
+    typename Layout::template Slot<V> value;
+    K key;
+};
+
+/**
+ * @brief Template for slim pairing heap data structures.
+ *
+ * Slim pairing heaps are pairing heaps which maintain a single tree instead
+ * of a forest, as originally proposed by Fredman et al. Nodes keep three
+ * instead of four pointers, since siblings form a list which is linked in
+ * both directions and only the leftmost child refers to its parent. Linking
+ * two trees writes four pointers, cutting a subtree at most three.
+ *
+ * Insertions and decreasing keys link the new or cut tree with the root
+ * right away, hence the minimum is always the root. Deleting the minimum
+ * combines the children of the root by the pairing strategy, either
+ * `TwoPassPairing` or `MultipassPairing`. The strategies `LazyPairing` and
+ * `AuxiliaryTwoPassPairing` buffer trees in a forest and are supported by
+ * `PairingHeap` only.
+ *
+ * This allows for insertions, decreasing keys and merging in constant time
+ * as well as deletions in logarithmic amortized time.
+ *
+ * All operations are statically dispatched. Use `HeapAdapter` to access the
+ * heap through `IHeap`.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @tparam Compare Template parameter for the strict weak ordering of keys,
+ * the heap maintains the smallest key with respect to it
+ * @tparam Pairing Template parameter for the pairing strategy
+ * @tparam Stats Template parameter for the instrumentation policy, either
+ * `NoStats` or `CountingStats`
+ * @tparam Layout Template parameter for the node layout, either
+ * `InlineValues` or `SplitValues`
+ */
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+class SlimPairingHeap
+: public HeapBase<SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>, V,
+    K, SPNode<V, K, Layout>*>
+{
+    static_assert(std::is_same<Pairing, TwoPassPairing>::value
+        || std::is_same<Pairing, MultipassPairing>::value,
+        "slim pairing heaps combine a single tree by two-pass or multipass "
+        "pairing");
+
+private:
+    SPNode<V, K, Layout>* root;
+    int count;
+
+    std::shared_ptr<NodePool<SPNode<V, K, Layout>>> pool;
+
+    // values of the nodes, unless stored within the nodes
+    typename Layout::template Store<V> values;
+
+    Compare compare;
+
+    Stats statistics;
+
+public:
+    /**
+     * @brief Constructs a new slim pairing heap with its own node pool.
+     *
+     * @param compare The ordering of keys
+     */
+    explicit SlimPairingHeap(const Compare& compare = Compare())
+    : pool(std::make_shared<NodePool<SPNode<V, K, Layout>>>()),
+        compare(compare)
+    {
+        _init();
+    }
+
+    /**
+     * @brief Constructs a new slim pairing heap allocating from a given pool.
+     *
+     * Heaps that are going to be merged should share one pool, such that
+     * merging does not need to transfer or retain any slabs.
+     *
+     * @param pool The node pool to allocate nodes from
+     * @param compare The ordering of keys
+     */
+    explicit SlimPairingHeap(
+        std::shared_ptr<NodePool<SPNode<V, K, Layout>>> pool,
+        const Compare& compare = Compare())
+    : pool(pool), compare(compare)
+    {
+        assert(pool);
+
+        _init();
+    }
+
+    SlimPairingHeap(const SlimPairingHeap&) = delete;
+    SlimPairingHeap& operator=(const SlimPairingHeap&) = delete;
+
+    /**
+     * @brief Destroys the slim pairing heap.
+     *
+     * Deletes all nodes of the tree maintained by the heap.
+     *
+     */
+    ~SlimPairingHeap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Deletes all nodes of the slim pairing heap.
+     *
+     * If the heap is the only user of its node pool and nodes are trivially
+     * destructible, all slabs are released at once. Otherwise, every node is
+     * destroyed and returned to the pool separately.
+     *
+     * Runtime: \f$ O(1) \f$ or \f$ O(n) \f$, respectively
+     */
+    void clear()
+    {
+        if (pool.use_count() == 1
+            && std::is_trivially_destructible<SPNode<V, K, Layout>>::value
+            && values.releasable())
+        {
+            pool->release();
+            values.release();
+        }
+        else if (root)
+        {
+            _deleteAll(root);
+        }
+
+        _init();
+    }
+
+    /**
+     * @brief Reserves space for a number of elements.
+     *
+     * Neither the node pool nor the value storage grow until more than `n`
+     * elements are in the heap.
+     *
+     * @param n Number of elements to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        pool->reserve(n);
+        values.reserve(n);
+    }
+
+    /**
+     * @brief Determines the current size of the slim pairing heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the slim pairing heap.
+     *
+     * The value is copied into the new node once, which is linked with the
+     * root afterwards.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `value`
+     * @return A pointer to the resulting heap node
+     */
+    SPNode<V, K, Layout>* insert(const V& element, const K& key)
+    {
+        return emplace(key, element);
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the slim pairing heap, moving
+     * both into the new node.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param element Value to insert
+     * @param key Key associated with `value`
+     * @return A pointer to the resulting heap node
+     */
+    SPNode<V, K, Layout>* insert(V&& element, K&& key)
+    {
+        return emplace(std::move(key), std::move(element));
+    }
+
+    /**
+     * @brief Inserts a value constructed in place from given arguments.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param key Key associated with the new value
+     * @param args Arguments passed to the constructor of the value
+     * @return A pointer to the resulting heap node
+     */
+    template<class... Args>
+    SPNode<V, K, Layout>* emplace(K key, Args&&... args);
+
+    /**
+     * @brief Determines the value of the node with the smallest key.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return A reference to the value of the smallest element, valid until
+     * the element is deleted
+     */
+    const V& min()
+    {
+        assert(root);
+
+        return root->value.get();
+    }
+
+    /**
+     * @brief Deletes the heap node with smallest key and returns its value.
+     *
+     * The children of the root are combined into the new tree.
+     *
+     * Runtime: \f$ O(\log n) \f$ amortized
+     *
+     * @return The value of the smallest element
+     */
+    V deleteMin()
+    {
+        assert(root);
+
+        V value = std::move(root->value.get());
+
+        root = _delete(root);
+
+        return value;
+    }
+
+    /**
+     * @brief Removes a given node from the slim pairing heap.
+     *
+     * If the node is not the root, its subtree is cut from its parent. The
+     * children of the node are combined and linked with the root.
+     *
+     * Runtime: \f$ O(\log n) \f$ amortized
+     *
+     * @param handle Pointer to the node to remove
+     * @return Value of the deleted node
+     */
+    V remove(SPNode<V, K, Layout>* handle);
+
+    /**
+     * @brief Decreases the key of a given heap node.
+     *
+     * A node which is not the root is cut from its parent and linked with
+     * the root.
+     *
+     * Runtime: \f$ O(\log \log n) \leq T \leq O(\log n) \f$ amortized
+     *
+     * @param handle Pointer to the heap node
+     * @param key New key value of the heap node
+     */
+    void decreaseKey(SPNode<V, K, Layout>* handle, K key);
+
+    /**
+     * @brief Merges two instances of slim pairing heaps.
+     *
+     * Both trees are linked and `heap` is left empty. Nodes of `heap` move
+     * into this heap, hence their storage must outlive this heap: if both
+     * heaps use different node pools, the slabs of the other pool are either
+     * moved into the pool of this heap or, if the other pool is still shared
+     * with further heaps, retained by it.
+     *
+     * Runtime: \f$ O(1) \f$ for shared pools
+     *
+     * @param heap Pointer to the slim pairing heap to merge with
+     */
+    void merge(SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>* heap);
+
+    /**
+     * @brief Gets the root of the tree.
+     *
+     * @return A pointer to the node with the smallest key
+     */
+    SPNode<V, K, Layout>* getRoot()
+    {
+        return root;
+    }
+
+    /**
+     * @brief Gets the operation counters of the heap.
+     *
+     * Counters are only maintained if the heap is instantiated with
+     * `CountingStats`.
+     *
+     * @return The instrumentation policy of the heap
+     */
+    const Stats& stats()
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief Resets the operation counters of the heap.
+     *
+     */
+    void resetStats()
+    {
+        statistics.reset();
+    }
+
+    /**
+     * @brief Gets the node pool the heap allocates its nodes from.
+     *
+     * @return A shared pointer to the node pool
+     */
+    std::shared_ptr<NodePool<SPNode<V, K, Layout>>> getPool()
+    {
+        return pool;
+    }
+
+private:
+    void _init();
+
+    void _deleteAll(SPNode<V, K, Layout>* handle);
+
+    void _free(SPNode<V, K, Layout>* handle);
+
+    void _cut(SPNode<V, K, Layout>* handle);
+
+    void _link(SPNode<V, K, Layout>* a, SPNode<V, K, Layout>* b);
+
+    SPNode<V, K, Layout>* _union(SPNode<V, K, Layout>* a,
+        SPNode<V, K, Layout>* b);
+
+    SPNode<V, K, Layout>* _delete(SPNode<V, K, Layout>* handle);
+
+    SPNode<V, K, Layout>* _pop(SPNode<V, K, Layout>*& list);
+
+    SPNode<V, K, Layout>* _pair(SPNode<V, K, Layout>* list, TwoPassPairing);
+
+    SPNode<V, K, Layout>* _pair(SPNode<V, K, Layout>* list, MultipassPairing);
+};
+
+#include "SlimPairingHeap.hpp"
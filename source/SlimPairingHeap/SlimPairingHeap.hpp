@@ -0,0 +1,320 @@
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_init()
+{
+    root = NULL;
+    count = 0;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_deleteAll(
+    SPNode<V, K, Layout>* handle)
+{
+    SPNode<V, K, Layout>* current = handle;
+    while (current)
+    {
+        // splice children into the list behind the current node
+        if (current->child)
+        {
+            SPNode<V, K, Layout>* last = current->child;
+            while (last->next)
+            {
+                last = last->next;
+            }
+            last->next = current->next;
+            current->next = current->child;
+        }
+
+        SPNode<V, K, Layout>* node = current;
+        current = current->next;
+        _free(node);
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_free(
+    SPNode<V, K, Layout>* handle)
+{
+    values.destroy(handle->value);
+    handle->~SPNode<V, K, Layout>();
+    pool->deallocate(handle);
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+template<class... Args>
+SPNode<V, K, Layout>*
+SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::emplace(K key,
+    Args&&... args)
+{
+    SPNode<V, K, Layout>* node = new (pool->allocate())
+        SPNode<V, K, Layout>(std::move(key), values,
+            std::forward<Args>(args)...);
+
+    node->child = NULL;
+    node->next = NULL;
+    node->prev = NULL;
+
+    root = root ? _union(root, node) : node;
+    ++count;
+
+    return node;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+V SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::remove(
+    SPNode<V, K, Layout>* handle)
+{
+    V value = std::move(handle->value.get());
+
+    if (handle == root)
+    {
+        root = _delete(handle);
+
+        return value;
+    }
+
+    _cut(handle);
+
+    SPNode<V, K, Layout>* tree = _delete(handle);
+    if (tree)
+    {
+        root = _union(root, tree);
+    }
+
+    return value;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::decreaseKey(
+    SPNode<V, K, Layout>* handle, K key)
+{
+    statistics.comparison();
+    if (!compare(key, handle->key))
+    {
+        return;
+    }
+
+    handle->key = std::move(key);
+
+    // the root remains the root, any other node is linked with it
+    if (handle != root)
+    {
+        _cut(handle);
+        root = _union(root, handle);
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::merge(
+    SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>* heap)
+{
+    if (heap == this || !heap->root)
+    {
+        return;
+    }
+
+    if (heap->pool != pool)
+    {
+        if (heap->pool.use_count() == 1)
+        {
+            pool->splice(*heap->pool);
+        }
+        else
+        {
+            pool->retain(heap->pool);
+        }
+    }
+
+    values.merge(heap->values);
+
+    root = root ? _union(root, heap->root) : heap->root;
+    count += heap->count;
+
+    heap->_init();
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_cut(
+    SPNode<V, K, Layout>* handle)
+{
+    // the left sibling of a leftmost child is its parent
+    if (handle->prev->child == handle)
+    {
+        handle->prev->child = handle->next;
+    }
+    else
+    {
+        handle->prev->next = handle->next;
+    }
+
+    if (handle->next)
+    {
+        handle->next->prev = handle->prev;
+    }
+
+    handle->next = NULL;
+    handle->prev = NULL;
+
+    statistics.cut();
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+void SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_link(
+    SPNode<V, K, Layout>* a, SPNode<V, K, Layout>* b)
+{
+    // insert b as leftmost child of a
+    b->next = a->child;
+    if (a->child)
+    {
+        a->child->prev = b;
+    }
+
+    b->prev = a;
+    a->child = b;
+
+    statistics.link();
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+SPNode<V, K, Layout>*
+SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_union(
+    SPNode<V, K, Layout>* a, SPNode<V, K, Layout>* b)
+{
+    assert(!a->prev);
+    assert(!b->prev);
+
+    statistics.comparison();
+    if (compare(a->key, b->key))
+    {
+        _link(a, b);
+
+        return a;
+    }
+    else
+    {
+        _link(b, a);
+
+        return b;
+    }
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+SPNode<V, K, Layout>*
+SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_delete(
+    SPNode<V, K, Layout>* handle)
+{
+    SPNode<V, K, Layout>* children = handle->child;
+
+    _free(handle);
+    --count;
+
+    if (!children)
+    {
+        return NULL;
+    }
+
+    children->prev = NULL;
+
+    // counting the trees takes an extra pass, only if instrumented
+    if (Stats::enabled)
+    {
+        std::uint64_t trees = 0;
+        for (SPNode<V, K, Layout>* node = children; node; node = node->next)
+        {
+            ++trees;
+        }
+
+        statistics.consolidation(trees);
+    }
+
+    return _pair(children, Pairing());
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+SPNode<V, K, Layout>*
+SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pop(
+    SPNode<V, K, Layout>*& list)
+{
+    SPNode<V, K, Layout>* node = list;
+    list = node->next;
+
+    node->next = NULL;
+    node->prev = NULL;
+
+    return node;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+SPNode<V, K, Layout>*
+SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pair(
+    SPNode<V, K, Layout>* list, TwoPassPairing)
+{
+    // link pairs from left to right, stacking the survivors
+    SPNode<V, K, Layout>* stack = NULL;
+    while (list)
+    {
+        SPNode<V, K, Layout>* node = _pop(list);
+        if (list)
+        {
+            node = _union(node, _pop(list));
+        }
+
+        node->next = stack;
+        stack = node;
+    }
+
+    // link survivors from right to left
+    SPNode<V, K, Layout>* tree = NULL;
+    while (stack)
+    {
+        SPNode<V, K, Layout>* node = _pop(stack);
+        tree = tree ? _union(tree, node) : node;
+    }
+
+    return tree;
+}
+
+template<class V, class K, class Compare, class Pairing, class Stats,
+    class Layout>
+SPNode<V, K, Layout>*
+SlimPairingHeap<V, K, Compare, Pairing, Stats, Layout>::_pair(
+    SPNode<V, K, Layout>* list, MultipassPairing)
+{
+    SPNode<V, K, Layout>* end = list;
+    while (end->next)
+    {
+        end = end->next;
+    }
+
+    // link the first two trees and append the result to the queue
+    while (list != end)
+    {
+        SPNode<V, K, Layout>* a = _pop(list);
+        SPNode<V, K, Layout>* b = _pop(list);
+        SPNode<V, K, Layout>* node = _union(a, b);
+
+        if (list)
+        {
+            end->next = node;
+        }
+        else
+        {
+            list = node;
+        }
+        end = node;
+    }
+
+    return list;
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "Graph.h"
+#include "../interface/HeapBase.h"
+#include "../interface/IndexedHeap.h"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Operation counts and result checksum of a single algorithm run.
+ */
+struct RunStats
+{
+    std::uint64_t inserts;
+    std::uint64_t deleteMins;
+    std::uint64_t decreaseKeys;
+
+    std::int64_t checksum;
+
+    RunStats()
+    : inserts(0), deleteMins(0), decreaseKeys(0), checksum(0)
+    {
+    }
+
+    /**
+     * @brief Determines the total number of heap operations.
+     * 
+     * @return The sum of all operation counts
+     */
+    std::uint64_t operations() const
+    {
+        return inserts + deleteMins + decreaseKeys;
+    }
+};
+
+/**
+ * @brief Computes shortest path distances from a source vertex.
+ *
+ * The checksum is the sum of all distances.
+ * 
+ * @tparam Heap Template parameter for heaps with `int` values and 
+ * `std::int64_t` keys
+ * @param graph The graph to search
+ * @param source The source vertex
+ * @param heap An empty indexed heap for the vertices of `graph` to use, e.g. 
+ * to inspect it afterwards
+ * @param stats Operation counts are added to these statistics
+ */
+template<class Heap>
+void dijkstra(const Graph& graph, int source, IndexedHeap<Heap>& heap, 
+    RunStats& stats)
+{
+    static_assert(IsHeap<Heap>::value, "Heap must implement HeapBase");
+
+    const std::int64_t infinity = std::numeric_limits<std::int64_t>::max();
+
+    assert(heap.empty());
+
+    std::vector<std::int64_t> distances(graph.n, infinity);
+    std::vector<char> settled(graph.n, 0);
+
+    distances[source] = 0;
+    heap.insert(source, 0);
+    ++stats.inserts;
+
+    while (!heap.empty())
+    {
+        int u = heap.deleteMin();
+        ++stats.deleteMins;
+        settled[u] = 1;
+
+        for (int e = graph.begin(u); e < graph.end(u); ++e)
+        {
+            int v = graph.targets[e];
+            std::int64_t distance = distances[u] + graph.weights[e];
+
+            if (settled[v] || !(distance < distances[v]))
+            {
+                continue;
+            }
+
+            if (heap.insertOrDecrease(v, distance))
+            {
+                ++stats.inserts;
+            }
+            else
+            {
+                ++stats.decreaseKeys;
+            }
+
+            distances[v] = distance;
+        }
+    }
+
+    for (int v = 0; v < graph.n; ++v)
+    {
+        if (distances[v] != infinity)
+        {
+            stats.checksum += distances[v];
+        }
+    }
+}
+
+/**
+ * @brief Computes shortest path distances from a source vertex with a new 
+ * heap.
+ *
+ * @tparam Heap Template parameter for heaps with `int` values and 
+ * `std::int64_t` keys
+ * @param graph The graph to search
+ * @param source The source vertex
+ * @param stats Operation counts are added to these statistics
+ */
+template<class Heap>
+void dijkstra(const Graph& graph, int source, RunStats& stats)
+{
+    IndexedHeap<Heap> heap(graph.n);
+    dijkstra(graph, source, heap, stats);
+}
+
+/**
+ * @brief Computes a minimum spanning tree with Prim's algorithm.
+ *
+ * The checksum is the weight of the spanning tree.
+ * 
+ * @tparam Heap Template parameter for heaps with `int` values and 
+ * `std::int64_t` keys
+ * @param graph The connected graph to span
+ * @param stats Operation counts are added to these statistics
+ */
+template<class Heap>
+void prim(const Graph& graph, RunStats& stats)
+{
+    static_assert(IsHeap<Heap>::value, "Heap must implement HeapBase");
+
+    const std::int64_t infinity = std::numeric_limits<std::int64_t>::max();
+
+    IndexedHeap<Heap> heap(graph.n);
+    std::vector<std::int64_t> weights(graph.n, infinity);
+    std::vector<char> spanned(graph.n, 0);
+
+    weights[0] = 0;
+    heap.insert(0, 0);
+    ++stats.inserts;
+
+    while (!heap.empty())
+    {
+        int u = heap.deleteMin();
+        ++stats.deleteMins;
+        spanned[u] = 1;
+        stats.checksum += weights[u];
+
+        for (int e = graph.begin(u); e < graph.end(u); ++e)
+        {
+            int v = graph.targets[e];
+            std::int64_t weight = graph.weights[e];
+
+            if (spanned[v] || !(weight < weights[v]))
+            {
+                continue;
+            }
+
+            if (heap.insertOrDecrease(v, weight))
+            {
+                ++stats.inserts;
+            }
+            else
+            {
+                ++stats.decreaseKeys;
+            }
+
+            weights[v] = weight;
+        }
+    }
+}
+
+/**
+ * @brief Computes the distance of two vertices with an A* search.
+ *
+ * Keys are tentative distances plus the euclidean lower bound to the 
+ * target. The checksum is the distance found.
+ * 
+ * @tparam Heap Template parameter for heaps with `int` values and 
+ * `std::int64_t` keys
+ * @param graph The graph to search
+ * @param source The source vertex
+ * @param target The target vertex
+ * @param stats Operation counts are added to these statistics
+ */
+template<class Heap>
+void astar(const Graph& graph, int source, int target, RunStats& stats)
+{
+    static_assert(IsHeap<Heap>::value, "Heap must implement HeapBase");
+
+    const std::int64_t infinity = std::numeric_limits<std::int64_t>::max();
+
+    IndexedHeap<Heap> heap(graph.n);
+    std::vector<std::int64_t> distances(graph.n, infinity);
+    std::vector<char> settled(graph.n, 0);
+
+    distances[source] = 0;
+    heap.insert(source, graph.heuristic(source, target));
+    ++stats.inserts;
+
+    while (!heap.empty())
+    {
+        int u = heap.deleteMin();
+        ++stats.deleteMins;
+        settled[u] = 1;
+
+        if (u == target)
+        {
+            stats.checksum += distances[u];
+            break;
+        }
+
+        for (int e = graph.begin(u); e < graph.end(u); ++e)
+        {
+            int v = graph.targets[e];
+            std::int64_t distance = distances[u] + graph.weights[e];
+
+            if (settled[v] || !(distance < distances[v]))
+            {
+                continue;
+            }
+
+            std::int64_t key = distance + graph.heuristic(v, target);
+
+            if (heap.insertOrDecrease(v, key))
+            {
+                ++stats.inserts;
+            }
+            else
+            {
+                ++stats.decreaseKeys;
+            }
+
+            distances[v] = distance;
+        }
+    }
+}
@@ -0,0 +1,1267 @@
+#include "Algorithms.h"
+#include "ConcurrentBenchmark.h"
+#include "Graph.h"
+#include "HeapList.h"
+#include "LatencyHistogram.h"
+#include "LazyQueue.h"
+#include "MemoryTracker.h"
+#include "OperationProfile.h"
+#include "PerfCounter.h"
+#include "ProfiledHeap.h"
+
+#include "../interface/HeapAdapter.h"
+#include "../FibonacciHeap/FibonacciHeap.h"
+#include "../PairingHeap/PairingHeap.h"
+#include "../SlimPairingHeap/SlimPairingHeap.h"
+#include "../RankPairingHeap/RankPairingHeap.h"
+#include "../HollowHeap/HollowHeap.h"
+#include "../CompactFibonacciHeap/CompactFibonacciHeap.h"
+#include "../CompactPairingHeap/CompactPairingHeap.h"
+#include "../DAryHeap/DAryHeap.h"
+#include "../RadixHeap/RadixHeap.h"
+#include "../BucketQueue/BucketQueue.h"
+#include "../SequenceHeap/SequenceHeap.h"
+#include "../util/Snapshot.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+typedef std::int64_t Key;
+typedef std::less<Key> Less;
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    double _seconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    std::uint64_t _nanoseconds(Clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - start).count();
+    }
+
+    struct Workload
+    {
+        Graph graph;
+        std::vector<int> sources;
+        std::vector<std::pair<int, int>> pairs;
+    };
+
+    /**
+     * @brief Runs Dijkstra, Prim and A* on one graph with every heap.
+     */
+    class GraphBenchmark
+    {
+    private:
+        const Workload& workload;
+
+        // checksums of the first heap serve as reference
+        std::map<std::string, std::int64_t> checksums;
+
+    public:
+        explicit GraphBenchmark(const Workload& workload)
+        : workload(workload)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            RunStats stats;
+            const Graph& graph = workload.graph;
+
+            _start();
+            for (std::size_t i = 0; i < workload.sources.size(); ++i)
+            {
+                dijkstra<Heap>(graph, workload.sources[i], stats);
+            }
+            _report("dijkstra", name, stats);
+
+            if (!IsMonotone<Heap>::value)
+            {
+                stats = RunStats();
+                _start();
+                prim<Heap>(graph, stats);
+                _report("prim", name, stats);
+            }
+
+            stats = RunStats();
+            _start();
+            for (std::size_t i = 0; i < workload.pairs.size(); ++i)
+            {
+                astar<Heap>(graph, workload.pairs[i].first, 
+                    workload.pairs[i].second, stats);
+            }
+            _report("a*", name, stats);
+        }
+
+        /**
+         * @brief Runs Dijkstra with a bucket queue sized to the largest edge 
+         * weight of the graph.
+         */
+        void visitBucketQueue(const char* name)
+        {
+            RunStats stats;
+            const Graph& graph = workload.graph;
+
+            std::int64_t range = graph.weights.empty() ? 0 
+                : *std::max_element(graph.weights.begin(), 
+                    graph.weights.end());
+
+            _start();
+            for (std::size_t i = 0; i < workload.sources.size(); ++i)
+            {
+                IndexedHeap<BucketQueue<int, Key>> heap(graph.n, range);
+                dijkstra(graph, workload.sources[i], heap, stats);
+            }
+            _report("dijkstra", name, stats);
+        }
+
+    private:
+        Clock::time_point start;
+        std::size_t memory;
+
+        void _start()
+        {
+            memory = MemoryTracker::current();
+            MemoryTracker::resetPeak();
+            start = Clock::now();
+        }
+
+        void _report(const char* algorithm, const char* name, 
+            const RunStats& stats)
+        {
+            double seconds = _seconds(start);
+            double peak = (MemoryTracker::peak() - memory) / 1024.0;
+
+            std::string id = algorithm;
+            bool valid = true;
+            if (checksums.count(id))
+            {
+                valid = checksums[id] == stats.checksum;
+            }
+            else
+            {
+                checksums[id] = stats.checksum;
+            }
+
+            std::printf("%-10s %-9s %-22s %10.2f %12llu %10.2f %12.1f  %s\n",
+                workload.graph.name.c_str(), algorithm, name,
+                1000.0 * seconds,
+                static_cast<unsigned long long>(stats.operations()),
+                stats.operations() / seconds / 1e6,
+                peak,
+                valid ? "ok" : "MISMATCH");
+        }
+    };
+
+    /**
+     * @brief Measures the average time of each heap operation separately.
+     */
+    class OperationBenchmark
+    {
+    private:
+        int n;
+        unsigned seed;
+
+    public:
+        OperationBenchmark(int n, unsigned seed)
+        : n(n), seed(seed)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            std::mt19937 rng(seed);
+            std::vector<Key> keys(n);
+            for (int i = 0; i < n; ++i)
+            {
+                keys[i] = rng() % (1 << 30);
+            }
+
+            std::vector<int> order(n);
+            for (int i = 0; i < n; ++i)
+            {
+                order[i] = rng() % n;
+            }
+
+            double build = _build<Heap>(keys);
+
+            std::size_t memory = MemoryTracker::current();
+            MemoryTracker::resetPeak();
+
+            Heap heap;
+            std::vector<typename Heap::handle_type> handles(n);
+
+            Clock::time_point start = Clock::now();
+            for (int i = 0; i < n; ++i)
+            {
+                handles[i] = heap.insert(i, keys[i]);
+            }
+            double insert = _seconds(start);
+
+            start = Clock::now();
+            for (int i = 0; i < n; ++i)
+            {
+                int j = order[i];
+                keys[j] -= std::min<Key>(keys[j], 1 + keys[j] % 1024);
+                heap.decreaseKey(handles[j], keys[j]);
+            }
+            double decreaseKey = _seconds(start);
+
+            // deletions must not allocate once all nodes are in place
+            std::size_t allocations = MemoryTracker::allocations();
+
+            start = Clock::now();
+            std::int64_t checksum = 0;
+            for (int i = 0; i < n; ++i)
+            {
+                checksum += heap.deleteMin();
+            }
+            double deleteMin = _seconds(start);
+
+            allocations = MemoryTracker::allocations() - allocations;
+
+            double bytes = static_cast<double>(MemoryTracker::peak() - memory);
+
+            std::printf("%-22s %12.1f %12.1f %12.1f %12.1f %14.1f %13llu%s\n", 
+                name, 1e9 * build / n, 1e9 * insert / n, 1e9 * decreaseKey / n, 
+                1e9 * deleteMin / n, bytes / n, 
+                static_cast<unsigned long long>(allocations),
+                checksum == static_cast<std::int64_t>(n) * (n - 1) / 2 
+                    ? "" : "  MISMATCH");
+        }
+
+    private:
+        template<class Heap>
+        double _build(std::vector<Key>& keys)
+        {
+            std::vector<int> values(n);
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = i;
+            }
+
+            Heap heap;
+
+            Clock::time_point start = Clock::now();
+            heap.build(values, keys);
+
+            return _seconds(start);
+        }
+    };
+
+    /**
+     * @brief Compares single insertions and deletions with batched ones.
+     *
+     * Starting from `n` elements, every round inserts and then deletes `k` 
+     * elements, which models a priority queue feeding a batch of workers.
+     */
+    class BatchBenchmark
+    {
+    private:
+        int n;
+        int k;
+        unsigned seed;
+
+    public:
+        BatchBenchmark(int n, int k, unsigned seed)
+        : n(n), k(k), seed(seed)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            double single = _run<Heap>(false);
+            double batch = _run<Heap>(true);
+
+            std::printf("%-22s %12d %12.1f %13.1f %10.2fx\n", name, k,
+                single, batch, single / batch);
+        }
+
+    private:
+        template<class Heap>
+        double _run(bool batched)
+        {
+            std::mt19937 rng(seed);
+            std::vector<int> values(n);
+            std::vector<Key> keys(n);
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = i;
+                keys[i] = rng() % (1 << 30);
+            }
+
+            Heap heap;
+            heap.build(values, keys);
+
+            int rounds = std::max(1, n / k);
+            std::vector<int> out;
+            out.reserve(k);
+
+            Clock::time_point start = Clock::now();
+            for (int round = 0; round < rounds; ++round)
+            {
+                for (int i = 0; i < k; ++i)
+                {
+                    keys[i] = rng() % (1 << 30);
+                }
+
+                out.clear();
+                if (batched)
+                {
+                    heap.insertBatch(values.begin(), values.begin() + k, 
+                        keys.begin());
+                    heap.deleteMinBatch(k, out);
+                }
+                else
+                {
+                    for (int i = 0; i < k; ++i)
+                    {
+                        heap.insert(values[i], keys[i]);
+                    }
+                    for (int i = 0; i < k; ++i)
+                    {
+                        out.push_back(heap.deleteMin());
+                    }
+                }
+            }
+
+            return 1e9 * _seconds(start) / (static_cast<double>(rounds) * k);
+        }
+    };
+
+    /**
+     * @brief Value type modelling a task descriptor of 200 bytes.
+     *
+     * Copies and moves are counted globally, such that benchmarks can verify 
+     * how often values are transferred by a heap.
+     */
+    struct Task
+    {
+        static std::uint64_t copies;
+        static std::uint64_t moves;
+
+        char payload[200];
+
+        explicit Task(int id)
+        {
+            std::memset(payload, 0, sizeof(payload));
+            std::memcpy(payload, &id, sizeof(id));
+        }
+
+        Task(const Task& other)
+        {
+            std::memcpy(payload, other.payload, sizeof(payload));
+            ++copies;
+        }
+
+        Task(Task&& other)
+        {
+            std::memcpy(payload, other.payload, sizeof(payload));
+            ++moves;
+        }
+
+        Task& operator=(const Task& other)
+        {
+            std::memcpy(payload, other.payload, sizeof(payload));
+            ++copies;
+
+            return *this;
+        }
+
+        Task& operator=(Task&& other)
+        {
+            std::memcpy(payload, other.payload, sizeof(payload));
+            ++moves;
+
+            return *this;
+        }
+
+        int id() const
+        {
+            int id;
+            std::memcpy(&id, payload, sizeof(id));
+
+            return id;
+        }
+    };
+
+    std::uint64_t Task::copies = 0;
+    std::uint64_t Task::moves = 0;
+
+    /**
+     * @brief Compares the ways of inserting large values into a heap.
+     *
+     * Every run inserts `n` tasks and deletes all of them again. Besides 
+     * time, it reports the copies and moves of tasks per element, comparing 
+     * copying and moving insertions, in-place construction and the 
+     * type-erased `IHeap` interface.
+     */
+    class ValueBenchmark
+    {
+    private:
+        int n;
+        unsigned seed;
+
+    public:
+        ValueBenchmark(int n, unsigned seed)
+        : n(n), seed(seed)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            Heap heap;
+            _run(name, "insert(const V&)", heap, 
+                [](Heap& heap, int id, Key key)
+                {
+                    Task task(id);
+                    heap.insert(task, key);
+                });
+            _run(name, "insert(V&&)", heap, 
+                [](Heap& heap, int id, Key key)
+                {
+                    heap.insert(Task(id), std::move(key));
+                });
+            _run(name, "emplace", heap, 
+                [](Heap& heap, int id, Key key)
+                {
+                    heap.emplace(key, id);
+                });
+
+            HeapAdapter<Heap> adapter;
+            _run(name, "IHeap::insert", 
+                static_cast<IHeap<Task, Key>&>(adapter), 
+                [](IHeap<Task, Key>& heap, int id, Key key)
+                {
+                    Task task(id);
+                    heap.insert(task, key);
+                });
+        }
+
+    private:
+        template<class Heap, class Insert>
+        void _run(const char* name, const char* mode, Heap& heap, 
+            Insert insert)
+        {
+            std::mt19937 rng(seed);
+
+            Task::copies = 0;
+            Task::moves = 0;
+
+            Clock::time_point start = Clock::now();
+            for (int i = 0; i < n; ++i)
+            {
+                insert(heap, i, rng() % (1 << 30));
+            }
+
+            // every id is deleted exactly once
+            long long sum = 0;
+            while (heap.size() > 0)
+            {
+                Task task = heap.deleteMin();
+                sum += task.id();
+            }
+            double seconds = _seconds(start);
+
+            bool ok = sum == static_cast<long long>(n) * (n - 1) / 2;
+
+            std::printf("%-22s %-18s %12.1f %14.2f %14.2f  %s\n", name, mode,
+                1e9 * seconds / n, static_cast<double>(Task::copies) / n, 
+                static_cast<double>(Task::moves) / n, ok ? "ok" : "FAILED");
+        }
+    };
+
+    /**
+     * @brief Compares node layouts of a heap for large values.
+     *
+     * Inserts `n` tasks, deletes a quarter of them, decreases random keys 
+     * and deletes all remaining tasks. Reports the node size, the memory per 
+     * element and, for the deletions and key decreases, the time and the 
+     * cache misses per element if hardware counters are available.
+     */
+    class LayoutBenchmark
+    {
+    private:
+        int n;
+        unsigned seed;
+
+    public:
+        LayoutBenchmark(int n, unsigned seed)
+        : n(n), seed(seed)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name, const char* layout)
+        {
+            typedef typename Heap::handle_type Handle;
+
+            std::mt19937 rng(seed);
+            std::vector<Handle> handles(n);
+            std::vector<Key> keys(n);
+            std::vector<bool> deleted(n, false);
+            for (int i = 0; i < n; ++i)
+            {
+                keys[i] = rng() % (1 << 30);
+            }
+
+            std::size_t before = MemoryTracker::current();
+            MemoryTracker::resetPeak();
+
+            Heap heap;
+            for (int i = 0; i < n; ++i)
+            {
+                handles[i] = heap.emplace(keys[i], i);
+            }
+
+            double bytes = 
+                static_cast<double>(MemoryTracker::peak() - before) / n;
+
+            PerfCounter misses;
+            Clock::time_point start = Clock::now();
+            misses.start();
+
+            for (int i = 0; i < n / 4; ++i)
+            {
+                deleted[heap.deleteMin().id()] = true;
+            }
+
+            for (int i = 0; i < n / 4; ++i)
+            {
+                int id = rng() % n;
+                if (!deleted[id])
+                {
+                    keys[id] -= rng() % (keys[id] + 1);
+                    heap.decreaseKey(handles[id], keys[id]);
+                }
+            }
+
+            while (heap.size() > 0)
+            {
+                deleted[heap.deleteMin().id()] = true;
+            }
+
+            std::uint64_t count = misses.stop();
+            double seconds = _seconds(start);
+
+            char perElement[32] = "n/a";
+            if (misses.available())
+            {
+                std::snprintf(perElement, sizeof(perElement), "%.2f", 
+                    static_cast<double>(count) / n);
+            }
+
+            std::printf("%-22s %-8s %10zu %14.1f %12.1f %16s\n", name, layout,
+                sizeof(typename std::remove_pointer<Handle>::type), bytes, 
+                1e9 * seconds / n, perElement);
+        }
+    };
+
+    /**
+     * @brief Compares restarting from a snapshot with rebuilding a heap.
+     *
+     * A heap of `n` elements is shaped by deleting a tenth of them and saved 
+     * to a file. Rebuilding inserts the remaining elements again, loading 
+     * restores them from the file, and both delete the minimum once, which 
+     * consolidates the rebuilt heap. Mapping only opens the file, checks it 
+     * and reads the smallest element in place.
+     */
+    class SnapshotBenchmark
+    {
+    private:
+        int n;
+        unsigned seed;
+
+    public:
+        SnapshotBenchmark(int n, unsigned seed)
+        : n(n), seed(seed)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name, Snapshot::Kind kind)
+        {
+            const char* path = "heaps_snapshot.bin";
+
+            std::mt19937 rng(seed);
+            std::vector<Key> keys(n);
+            std::vector<char> deleted(n, 0);
+
+            Heap heap;
+            for (int i = 0; i < n; ++i)
+            {
+                keys[i] = rng() % (1 << 30);
+                heap.insert(i, keys[i]);
+            }
+
+            for (int i = 0; i < n / 10; ++i)
+            {
+                deleted[heap.deleteMin()] = 1;
+            }
+
+            Clock::time_point start = Clock::now();
+            bool ok = heap.save(path);
+            double save = _seconds(start);
+
+            double rebuild;
+            double load;
+            double map;
+            int first[3];
+            {
+                Heap rebuilt;
+
+                start = Clock::now();
+                for (int i = 0; i < n; ++i)
+                {
+                    if (!deleted[i])
+                    {
+                        rebuilt.insert(i, keys[i]);
+                    }
+                }
+                first[0] = rebuilt.deleteMin();
+                rebuild = _seconds(start);
+            }
+            {
+                Heap loaded;
+
+                start = Clock::now();
+                ok = loaded.load(path) && ok;
+                first[1] = loaded.empty() ? -1 : loaded.deleteMin();
+                load = _seconds(start);
+            }
+            {
+                start = Clock::now();
+                SnapshotFile file(path);
+                const SnapshotNode<int, Key>* nodes = 
+                    file.nodes<int, Key>(kind);
+                first[2] = nodes ? nodes[file.header()->minPtr].value : -1;
+                map = _seconds(start);
+            }
+
+            double megabytes = 0;
+            if (std::FILE* file = std::fopen(path, "rb"))
+            {
+                std::fseek(file, 0, SEEK_END);
+                megabytes = std::ftell(file) / 1048576.0;
+                std::fclose(file);
+            }
+            std::remove(path);
+
+            ok = ok && first[1] >= 0 && first[2] >= 0 
+                && keys[first[0]] == keys[first[1]] 
+                && keys[first[0]] == keys[first[2]];
+
+            std::printf("%-22s %12.1f %12.1f %12.1f %12.1f %10.1f  %s\n", 
+                name, 1e3 * save, 1e3 * rebuild, 1e3 * load, 1e3 * map, 
+                megabytes, ok ? "ok" : "FAILED");
+        }
+    };
+
+    /**
+     * @brief Measures the latency distribution of every heap operation.
+     * 
+     * Like a scheduler, the workload alternates between bursts of insertions 
+     * and phases of deletions with decreases of random keys, each burst 
+     * inserting a twentieth of `n` elements. Every operation is timed on its 
+     * own, such that the percentiles show the tail latency of deletions after 
+     * a burst, which consolidation with a work budget is to bound. 
+     * 
+     * The heap either starts empty or with half of the elements inserted 
+     * before the budget is set or by merging another heap, which leaves a 
+     * long forest to the first operations.
+     */
+    class LatencyBenchmark
+    {
+    public:
+        enum Start
+        {
+            EMPTY,
+            FILLED,
+            MERGED
+        };
+
+    private:
+        int n;
+        unsigned seed;
+
+    public:
+        LatencyBenchmark(int n, unsigned seed)
+        : n(n), seed(seed)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name, int budget, Start start = EMPTY)
+        {
+            typedef typename Heap::handle_type Handle;
+
+            std::mt19937 rng(seed);
+            std::vector<Handle> handles(n);
+            std::vector<Key> keys(n);
+            std::vector<int> live;
+            std::vector<int> position(n, -1);
+
+            LatencyHistogram latencies[3];
+
+            // nodes are reserved up front, such that no operation allocates
+            Heap heap;
+            heap.getPool()->reserve(n);
+
+            int next = 0;
+            if (start == EMPTY)
+            {
+                heap.setBudget(budget);
+            }
+            else
+            {
+                // insert half of the elements without any budget
+                Heap other(heap.getPool());
+                Heap& target = (start == FILLED) ? heap : other;
+                for (; next < n / 2; ++next)
+                {
+                    keys[next] = rng() % (1 << 20);
+                    handles[next] = target.insert(next, keys[next]);
+
+                    position[next] = static_cast<int>(live.size());
+                    live.push_back(next);
+                }
+
+                heap.setBudget(budget);
+                heap.merge(&other);
+            }
+
+            int burst = std::max(n / 20, 1);
+            Key now = 0;
+            while (next < n)
+            {
+                for (int i = 0; i < burst && next < n; ++i, ++next)
+                {
+                    keys[next] = now + rng() % (1 << 20);
+
+                    Clock::time_point start = Clock::now();
+                    handles[next] = heap.insert(next, keys[next]);
+                    latencies[0].record(_nanoseconds(start));
+
+                    position[next] = static_cast<int>(live.size());
+                    live.push_back(next);
+                }
+
+                for (int i = 0; i < burst / 2 && !live.empty(); ++i)
+                {
+                    int id = live[rng() % live.size()];
+                    Key key = keys[id] - static_cast<Key>(rng() % 1024);
+                    keys[id] = std::max(key, now);
+
+                    Clock::time_point start = Clock::now();
+                    heap.decreaseKey(handles[id], keys[id]);
+                    latencies[1].record(_nanoseconds(start));
+
+                    start = Clock::now();
+                    int min = heap.deleteMin();
+                    latencies[2].record(_nanoseconds(start));
+
+                    now = keys[min];
+
+                    // swap the deleted id out of the live ids
+                    int last = live.back();
+                    live[position[min]] = last;
+                    position[last] = position[min];
+                    live.pop_back();
+                    position[min] = -1;
+                }
+            }
+
+            const char* starts[3] = { "empty", "filled", "merged" };
+            const char* operations[3] = 
+                { "insert", "decreaseKey", "deleteMin" };
+            for (int i = 0; i < 3; ++i)
+            {
+                const LatencyHistogram& histogram = latencies[i];
+
+                std::printf(
+                    "%-22s %8d %-8s %-12s %10llu %10llu %10llu %12llu\n", 
+                    name, budget, starts[start], operations[i], 
+                    static_cast<unsigned long long>(
+                        histogram.percentile(0.5)), 
+                    static_cast<unsigned long long>(
+                        histogram.percentile(0.99)), 
+                    static_cast<unsigned long long>(
+                        histogram.percentile(0.999)), 
+                    static_cast<unsigned long long>(histogram.max()));
+            }
+        }
+    };
+
+    /**
+     * @brief Profiles every heap operation through `IHeap`.
+     * 
+     * Every heap which can be adapted to `IHeap` is wrapped by a 
+     * `ProfiledHeap`, which inserts `n` elements, decreases the keys of half 
+     * of them, merges 64 heaps of 16 elements and deletes all elements 
+     * again. Latency percentiles and, where available, cache and branch 
+     * misses per operation are printed and written to a CSV and a JSON file.
+     */
+    class ProfileBenchmark
+    {
+    private:
+        int n;
+        unsigned seed;
+
+        std::FILE* csv;
+        std::FILE* json;
+        bool first;
+
+    public:
+        ProfileBenchmark(int n, unsigned seed, const char* csvPath, 
+            const char* jsonPath)
+        : n(n), seed(seed), first(true)
+        {
+            csv = std::fopen(csvPath, "w");
+            json = std::fopen(jsonPath, "w");
+
+            if (csv)
+            {
+                OperationProfile::writeCsvHeader(csv);
+            }
+            if (json)
+            {
+                std::fprintf(json, "[");
+            }
+        }
+
+        ProfileBenchmark(const ProfileBenchmark&) = delete;
+        ProfileBenchmark& operator=(const ProfileBenchmark&) = delete;
+
+        ~ProfileBenchmark()
+        {
+            if (csv)
+            {
+                std::fclose(csv);
+            }
+            if (json)
+            {
+                std::fprintf(json, "\n]\n");
+                std::fclose(json);
+            }
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            // monotone heaps do not support arbitrary keys
+            _visit<Heap>(name, std::integral_constant<bool, 
+                std::is_convertible<typename Heap::handle_type, 
+                    INode<int, Key>*>::value && !IsMonotone<Heap>::value>());
+        }
+
+    private:
+        template<class Heap>
+        void _visit(const char*, std::false_type)
+        {
+        }
+
+        template<class Heap>
+        void _visit(const char* name, std::true_type)
+        {
+            std::mt19937 rng(seed);
+            std::vector<INode<int, Key>*> handles(n);
+            std::vector<Key> keys(n);
+
+            OperationProfile profile;
+            HeapAdapter<Heap> adapter;
+            ProfiledHeap<int, Key> heap(adapter, profile);
+
+            for (int i = 0; i < n; ++i)
+            {
+                keys[i] = rng() % (1 << 30);
+                handles[i] = heap.insert(i, keys[i]);
+            }
+
+            for (int i = 0; i < n / 2; ++i)
+            {
+                int id = rng() % n;
+                keys[id] -= rng() % 1024 + 1;
+                heap.decreaseKey(handles[id], keys[id]);
+            }
+
+            for (int i = 0; i < 64; ++i)
+            {
+                HeapAdapter<Heap> other;
+                for (int j = 0; j < 16; ++j)
+                {
+                    other.insert(n + 16 * i + j, rng() % (1 << 30));
+                }
+                heap.merge(&other);
+            }
+
+            // ids of merged elements exceed n
+            bool ok = heap.size() == n + 64 * 16;
+            Key last = std::numeric_limits<Key>::min();
+            while (heap.size() > 0)
+            {
+                int id = heap.deleteMin();
+                if (id < n)
+                {
+                    ok = ok && keys[id] >= last;
+                    last = keys[id];
+                }
+            }
+
+            for (int i = 0; i < OperationProfile::OPERATIONS; ++i)
+            {
+                OperationProfile::Operation operation = 
+                    static_cast<OperationProfile::Operation>(i);
+                const LatencyHistogram& histogram = profile.latency(operation);
+
+                std::printf("%-22s %-12s %10llu %10llu %10llu %12llu ", name, 
+                    OperationProfile::name(operation), 
+                    static_cast<unsigned long long>(
+                        histogram.percentile(0.5)), 
+                    static_cast<unsigned long long>(
+                        histogram.percentile(0.99)), 
+                    static_cast<unsigned long long>(
+                        histogram.percentile(0.999)), 
+                    static_cast<unsigned long long>(histogram.max()));
+
+                if (profile.counters())
+                {
+                    std::printf("%12.2f %12.2f", 
+                        profile.cacheMissesPerOperation(operation), 
+                        profile.branchMissesPerOperation(operation));
+                }
+                else
+                {
+                    std::printf("%12s %12s", "n/a", "n/a");
+                }
+                std::printf("  %s\n", ok ? "ok" : "FAILED");
+            }
+
+            if (csv)
+            {
+                profile.writeCsv(csv, name);
+            }
+            if (json)
+            {
+                std::fprintf(json, "%s\n", first ? "" : ",");
+                profile.writeJson(json, name);
+            }
+            first = false;
+        }
+    };
+
+    /**
+     * @brief Measures external sequence heaps by throughput and I/O volume.
+     * 
+     * `n` random keys are inserted and all of them deleted again. Small run 
+     * sizes and degrees force spilling and merging of runs, such that the 
+     * bytes read and written per element show the cost of every merge level.
+     */
+    class ExternalBenchmark
+    {
+    private:
+        int n;
+        unsigned seed;
+
+    public:
+        ExternalBenchmark(int n, unsigned seed)
+        : n(n), seed(seed)
+        {
+        }
+
+        void visit(std::size_t runSize, std::size_t degree)
+        {
+            std::mt19937 rng(seed);
+
+            SequenceHeap<int, Key> heap(runSize, degree);
+
+            Clock::time_point start = Clock::now();
+            for (int i = 0; i < n; ++i)
+            {
+                heap.insert(i, rng() % (1 << 30));
+            }
+            double insert = _seconds(start);
+            std::size_t runs = heap.getRuns();
+
+            // regenerate the keys to check the order of deletions
+            rng.seed(seed);
+            std::vector<Key> keys(n);
+            for (int i = 0; i < n; ++i)
+            {
+                keys[i] = rng() % (1 << 30);
+            }
+
+            bool ok = heap.size() == static_cast<std::uint64_t>(n);
+            Key last = 0;
+
+            start = Clock::now();
+            while (!heap.empty())
+            {
+                Key key = keys[heap.deleteMin()];
+                ok = ok && key >= last;
+                last = key;
+            }
+            double deleteMin = _seconds(start);
+
+            std::printf("%-22s %10zu %8zu %8zu %12.1f %12.1f %12.1f "
+                "%12.1f  %s\n", "SequenceHeap", runSize, degree, runs, 
+                1e9 * insert / n, 1e9 * deleteMin / n, 
+                static_cast<double>(heap.getBytesWritten()) / n, 
+                static_cast<double>(heap.getBytesRead()) / n, 
+                ok ? "ok" : "FAILED");
+        }
+    };
+
+    /**
+     * @brief Dumps the operation counters of instrumented heaps for Dijkstra.
+     */
+    class StatsBenchmark
+    {
+    private:
+        const Workload& workload;
+
+    public:
+        explicit StatsBenchmark(const Workload& workload)
+        : workload(workload)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            RunStats runs;
+            IndexedHeap<Heap> heap(workload.graph.n);
+
+            for (std::size_t i = 0; i < workload.sources.size(); ++i)
+            {
+                dijkstra(workload.graph, workload.sources[i], heap, runs);
+            }
+
+            const CountingStats& stats = heap.getHeap().stats();
+            double roots = stats.consolidations 
+                ? static_cast<double>(stats.roots) / stats.consolidations : 0;
+
+            std::printf("%-10s %-22s %12llu %10llu %10llu %10llu %12.1f "
+                "%10llu %8d\n",
+                workload.graph.name.c_str(), name,
+                static_cast<unsigned long long>(stats.comparisons),
+                static_cast<unsigned long long>(stats.links),
+                static_cast<unsigned long long>(stats.cuts),
+                static_cast<unsigned long long>(stats.cascadingCuts),
+                roots,
+                static_cast<unsigned long long>(stats.maxRoots),
+                stats.maxRank);
+        }
+    };
+
+    Workload _workload(Graph graph, int queries, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> vertex(0, graph.n - 1);
+
+        Workload workload;
+        workload.graph = std::move(graph);
+
+        for (int i = 0; i < queries; ++i)
+        {
+            workload.sources.push_back(vertex(rng));
+            workload.pairs.push_back(std::make_pair(vertex(rng), vertex(rng)));
+        }
+
+        return workload;
+    }
+}
+
+/**
+ * @brief Compares all heaps on graph workloads.
+ *
+ * Usage: `heaps_bench [vertices] [queries] [threads]`
+ *
+ * Runs Dijkstra from `queries` random sources, Prim once and A* for 
+ * `queries` random pairs on a grid, a random sparse and a power-law graph 
+ * with roughly `vertices` vertices each. Afterwards, building a heap of 
+ * `vertices` elements and every heap operation are timed separately. The 
+ * operation counters of instrumented Fibonacci and pairing heaps are dumped 
+ * for Dijkstra, and batched insertions and deletions are compared with 
+ * single ones.
+ *
+ * Finally, the scaling of the concurrent MultiQueue is measured for up to 
+ * `threads` threads, which defaults to the number of hardware threads.
+ */
+int main(int argc, char** argv)
+{
+    int vertices = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    int queries = (argc > 2) ? std::atoi(argv[2]) : 4;
+    int threads = (argc > 3) 
+        ? std::atoi(argv[3]) 
+        : static_cast<int>(std::thread::hardware_concurrency());
+
+    int side = static_cast<int>(std::sqrt(static_cast<double>(vertices)));
+
+    std::vector<Workload> workloads;
+    workloads.push_back(_workload(gridGraph(side, side, 1), queries, 11));
+    workloads.push_back(_workload(randomGraph(vertices, 4, 2), queries, 12));
+    workloads.push_back(_workload(powerLawGraph(vertices, 3, 3), queries, 13));
+
+    std::printf("%-10s %-9s %-22s %10s %12s %10s %12s  %s\n",
+        "graph", "algorithm", "heap", "time [ms]", "operations", "Mops/s", 
+        "peak [KiB]", "check");
+
+    for (std::size_t i = 0; i < workloads.size(); ++i)
+    {
+        GraphBenchmark benchmark(workloads[i]);
+        forEachHeap<int, Key>(benchmark);
+        benchmark.visitBucketQueue("BucketQueue");
+    }
+
+    std::printf("\n%-22s %12s %12s %12s %12s %14s %13s\n", "heap", 
+        "build [ns]", "insert [ns]", "decKey [ns]", "delMin [ns]", 
+        "bytes/element", "delMin allocs");
+
+    OperationBenchmark operations(vertices, 4);
+    forEachHeap<int, Key>(operations);
+
+    std::printf("\n%-10s %-22s %12s %10s %10s %10s %12s %10s %8s\n", 
+        "graph", "heap", "comparisons", "links", "cuts", "cascading", 
+        "roots/pass", "max roots", "max rank");
+
+    for (std::size_t i = 0; i < workloads.size(); ++i)
+    {
+        StatsBenchmark stats(workloads[i]);
+        stats.visit<FibonacciHeap<int, Key, Less, CountingStats>>(
+            "FibonacciHeap");
+        stats.visit<PairingHeap<int, Key, Less, LazyPairing, CountingStats>>(
+            "PairingHeap");
+        stats.visit<
+            PairingHeap<int, Key, Less, TwoPassPairing, CountingStats>>(
+            "Pairing<TwoPass>");
+        stats.visit<
+            PairingHeap<int, Key, Less, MultipassPairing, CountingStats>>(
+            "Pairing<Multipass>");
+        stats.visit<
+            PairingHeap<int, Key, Less, AuxiliaryTwoPassPairing, 
+                CountingStats>>(
+            "Pairing<AuxTwoPass>");
+        stats.visit<
+            SlimPairingHeap<int, Key, Less, TwoPassPairing, CountingStats>>(
+            "SlimPairing<TwoPass>");
+        stats.visit<
+            SlimPairingHeap<int, Key, Less, MultipassPairing, CountingStats>>(
+            "SlimPairing<Multipass>");
+    }
+
+    std::printf("\n%-22s %12s %12s %13s %11s\n", "heap", "batch size", 
+        "single [ns]", "batched [ns]", "speedup");
+
+    BatchBenchmark batches(vertices, 256, 5);
+    batches.visit<FibonacciHeap<int, Key>>("FibonacciHeap");
+    batches.visit<PairingHeap<int, Key>>("PairingHeap");
+
+    std::printf("\n%-22s %-18s %12s %14s %14s  %s\n", "heap", "insertion", 
+        "time [ns]", "copies/element", "moves/element", "check");
+
+    ValueBenchmark values(vertices, 6);
+    values.visit<FibonacciHeap<Task, Key>>("FibonacciHeap");
+    values.visit<PairingHeap<Task, Key>>("PairingHeap");
+
+    std::printf("\n%-22s %-8s %10s %14s %12s %16s\n", "heap", "layout", 
+        "node [B]", "bytes/element", "time [ns]", "misses/element");
+
+    LayoutBenchmark layouts(vertices, 7);
+    layouts.visit<FibonacciHeap<Task, Key>>("FibonacciHeap", "inline");
+    layouts.visit<FibonacciHeap<Task, Key, Less, NoStats, SplitValues>>(
+        "FibonacciHeap", "split");
+    layouts.visit<PairingHeap<Task, Key>>("PairingHeap", "inline");
+    layouts.visit<
+        PairingHeap<Task, Key, Less, LazyPairing, NoStats, SplitValues>>(
+        "PairingHeap", "split");
+    layouts.visit<SlimPairingHeap<Task, Key>>("SlimPairingHeap", "inline");
+    layouts.visit<
+        SlimPairingHeap<Task, Key, Less, TwoPassPairing, NoStats, 
+            SplitValues>>(
+        "SlimPairingHeap", "split");
+
+    std::printf("\n%-22s %12s %12s %12s %12s %10s  %s\n", "heap", 
+        "save [ms]", "rebuild [ms]", "load [ms]", "map [ms]", "file [MB]", 
+        "check");
+
+    SnapshotBenchmark snapshots(10 * vertices, 8);
+    snapshots.visit<FibonacciHeap<int, Key>>("FibonacciHeap", 
+        Snapshot::FIBONACCI);
+    snapshots.visit<PairingHeap<int, Key>>("PairingHeap", Snapshot::PAIRING);
+
+    std::printf("\n%-22s %8s %-8s %-12s %10s %10s %10s %12s\n", "heap", 
+        "budget", "start", "operation", "p50 [ns]", "p99 [ns]", "p99.9 [ns]", 
+        "max [ns]");
+
+    LatencyBenchmark latencies(10 * vertices, 10);
+    latencies.visit<FibonacciHeap<int, Key>>("FibonacciHeap", 0);
+    latencies.visit<FibonacciHeap<int, Key>>("FibonacciHeap", 2);
+    latencies.visit<PairingHeap<int, Key>>("PairingHeap", 0);
+    latencies.visit<PairingHeap<int, Key>>("PairingHeap", 2);
+    latencies.visit<PairingHeap<int, Key, Less, TwoPassPairing>>(
+        "Pairing<TwoPass>", 0);
+    latencies.visit<PairingHeap<int, Key, Less, TwoPassPairing>>(
+        "Pairing<TwoPass>", 2);
+
+    // budgets set on a filled heap or merged heaps consolidate at once
+    typedef LatencyBenchmark Latency;
+    for (int budget = 0; budget <= 2; budget += 2)
+    {
+        latencies.visit<FibonacciHeap<int, Key>>("FibonacciHeap", budget, 
+            Latency::FILLED);
+        latencies.visit<FibonacciHeap<int, Key>>("FibonacciHeap", budget, 
+            Latency::MERGED);
+        latencies.visit<PairingHeap<int, Key>>("PairingHeap", budget, 
+            Latency::FILLED);
+        latencies.visit<PairingHeap<int, Key>>("PairingHeap", budget, 
+            Latency::MERGED);
+    }
+
+    std::printf("\n%-22s %-12s %10s %10s %10s %12s %12s %12s  %s\n", 
+        "heap", "operation", "p50 [ns]", "p99 [ns]", "p99.9 [ns]", 
+        "max [ns]", "cache miss", "branch miss", "check");
+
+    {
+        ProfileBenchmark profiles(vertices, 11, "heaps_profile.csv", 
+            "heaps_profile.json");
+        forEachHeap<int, Key>(profiles);
+    }
+
+    std::printf("\n%-22s %10s %8s %8s %12s %12s %12s %12s  %s\n", "heap", 
+        "run size", "degree", "runs", "insert [ns]", "delMin [ns]", 
+        "write [B/el]", "read [B/el]", "check");
+
+    int external = 10 * vertices;
+    ExternalBenchmark externals(external, 9);
+    externals.visit(external, 64);
+    externals.visit(std::max(external / 16, 1), 64);
+    externals.visit(std::max(external / 256, 1), 4);
+
+    std::printf("\n");
+    benchmarkMultiQueue((threads > 0) ? threads : 1, 10 * vertices);
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include "ConcurrentBenchmark.h"
+
+#include "../MultiQueue/MultiQueue.h"
+#include "../PairingHeap/PairingHeap.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+    typedef std::int64_t Key;
+
+    // keys are drawn from [0, KEYS)
+    const int KEYS = 1 << 20;
+
+    /**
+     * @brief PairingHeap behind a single mutex.
+     */
+    class LockedHeap
+    {
+    private:
+        std::mutex mutex;
+        PairingHeap<int, Key> heap;
+
+    public:
+        void insert(int element, Key key)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            heap.insert(element, key);
+        }
+
+        bool tryDeleteMin(int& element)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (heap.empty())
+            {
+                return false;
+            }
+
+            element = heap.deleteMin();
+
+            return true;
+        }
+    };
+
+    /**
+     * @brief Counts keys in a bounded range to determine ranks.
+     */
+    class FenwickTree
+    {
+    private:
+        std::vector<int> tree;
+
+    public:
+        explicit FenwickTree(int n)
+        : tree(n + 1, 0)
+        {
+        }
+
+        void add(int key, int delta)
+        {
+            for (int i = key + 1; i < static_cast<int>(tree.size()); i += i & -i)
+            {
+                tree[i] += delta;
+            }
+        }
+
+        // number of keys smaller than key
+        int rank(int key)
+        {
+            int count = 0;
+            for (int i = key; i > 0; i -= i & -i)
+            {
+                count += tree[i];
+            }
+
+            return count;
+        }
+    };
+
+    template<class Queue>
+    double _throughput(Queue& queue, int threads, int operations)
+    {
+        for (int i = 0; i < operations; ++i)
+        {
+            queue.insert(i, (i * 2654435761u) % KEYS);
+        }
+
+        std::atomic<bool> go(false);
+        std::vector<std::thread> workers;
+
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.push_back(std::thread([&queue, &go, t, threads, operations]()
+            {
+                std::mt19937 rng(t);
+                int element;
+
+                while (!go.load())
+                {
+                }
+
+                for (int i = t; i < operations; i += threads)
+                {
+                    if (rng() & 1)
+                    {
+                        queue.insert(i, rng() % KEYS);
+                    }
+                    else
+                    {
+                        queue.tryDeleteMin(element);
+                    }
+                }
+            }));
+        }
+
+        Clock::time_point start = Clock::now();
+        go.store(true);
+
+        for (int t = 0; t < threads; ++t)
+        {
+            workers[t].join();
+        }
+
+        double seconds = 
+            std::chrono::duration<double>(Clock::now() - start).count();
+
+        return operations / seconds / 1e6;
+    }
+
+    void _rankError(int threads, int operations, double& mean, int& max)
+    {
+        MultiQueue<int, Key> queue(threads);
+        FenwickTree ranks(KEYS);
+        std::mt19937 rng(threads);
+
+        for (int i = 0; i < operations; ++i)
+        {
+            int key = rng() % KEYS;
+            queue.insert(i, key);
+            ranks.add(key, 1);
+        }
+
+        std::uint64_t sum = 0;
+        int deletions = 0;
+        max = 0;
+
+        for (int i = 0; i < operations; ++i)
+        {
+            int key = rng() % KEYS;
+            queue.insert(i, key);
+            ranks.add(key, 1);
+
+            int element;
+            Key deleted;
+            queue.tryDeleteMin(element, deleted);
+
+            int rank = ranks.rank(static_cast<int>(deleted));
+            ranks.add(static_cast<int>(deleted), -1);
+
+            sum += rank;
+            max = (rank > max) ? rank : max;
+            ++deletions;
+        }
+
+        mean = static_cast<double>(sum) / deletions;
+    }
+}
+
+void benchmarkMultiQueue(int maxThreads, int operations)
+{
+    std::printf("%-8s %8s %19s %16s %12s %12s\n", "threads", "shards",
+        "MultiQueue [Mops/s]", "locked [Mops/s]", "mean rank", "max rank");
+
+    for (int threads = 1; threads <= maxThreads; 
+        threads = (threads < maxThreads && 2 * threads > maxThreads) 
+            ? maxThreads : 2 * threads)
+    {
+        double relaxed;
+        {
+            MultiQueue<int, Key> queue(threads);
+            relaxed = _throughput(queue, threads, operations);
+        }
+
+        double locked;
+        {
+            LockedHeap heap;
+            locked = _throughput(heap, threads, operations);
+        }
+
+        double mean;
+        int max;
+        _rankError(threads, operations / 4, mean, max);
+
+        std::printf("%-8d %8d %19.2f %16.2f %12.1f %12d\n", threads, 
+            2 * threads, relaxed, locked, mean, max);
+    }
+}
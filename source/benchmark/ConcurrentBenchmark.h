@@ -0,0 +1,18 @@
+#pragma once
+
+/**
+ * @brief Measures the scaling and the rank error of MultiQueues.
+ *
+ * For `1, 2, 4, ...` up to `maxThreads` threads, all threads perform 
+ * `operations` operations in total, alternating randomly between `insert` 
+ * and `tryDeleteMin`. The throughput of a MultiQueue is compared to a single 
+ * `PairingHeap` behind a mutex.
+ *
+ * The rank error of the MultiQueue for each number of threads is the number 
+ * of elements with smaller key at the time an element is deleted. It is 
+ * measured sequentially with the same number of shards.
+ * 
+ * @param maxThreads Maximum number of threads
+ * @param operations Total number of operations per run
+ */
+void benchmarkMultiQueue(int maxThreads, int operations);
@@ -0,0 +1,214 @@
+#include "Graph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+
+namespace
+{
+    struct Edge
+    {
+        int u;
+        int v;
+        std::int64_t weight;
+    };
+
+    double _euclidean(const Graph& graph, int u, int v)
+    {
+        double dx = graph.x[u] - graph.x[v];
+        double dy = graph.y[u] - graph.y[v];
+
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    void _addEdge(std::vector<Edge>& edges, const Graph& graph, 
+        std::mt19937& rng, int u, int v)
+    {
+        if (u == v)
+        {
+            return;
+        }
+
+        // weights are never smaller than the euclidean distance
+        std::int64_t weight = 
+            static_cast<std::int64_t>(std::ceil(_euclidean(graph, u, v)))
+            + 1 + rng() % 100;
+
+        Edge edge = { u, v, weight };
+        edges.push_back(edge);
+    }
+
+    void _buildAdjacency(Graph& graph, const std::vector<Edge>& edges)
+    {
+        graph.offsets.assign(graph.n + 1, 0);
+        for (std::size_t i = 0; i < edges.size(); ++i)
+        {
+            ++graph.offsets[edges[i].u + 1];
+            ++graph.offsets[edges[i].v + 1];
+        }
+
+        for (int v = 0; v < graph.n; ++v)
+        {
+            graph.offsets[v + 1] += graph.offsets[v];
+        }
+
+        std::vector<int> next(graph.offsets.begin(), graph.offsets.end() - 1);
+        graph.targets.resize(2 * edges.size());
+        graph.weights.resize(2 * edges.size());
+
+        for (std::size_t i = 0; i < edges.size(); ++i)
+        {
+            const Edge& edge = edges[i];
+
+            graph.targets[next[edge.u]] = edge.v;
+            graph.weights[next[edge.u]++] = edge.weight;
+            graph.targets[next[edge.v]] = edge.u;
+            graph.weights[next[edge.v]++] = edge.weight;
+        }
+    }
+
+    void _randomCoordinates(Graph& graph, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<double> coordinate(0.0, 10000.0);
+
+        graph.x.resize(graph.n);
+        graph.y.resize(graph.n);
+        for (int v = 0; v < graph.n; ++v)
+        {
+            graph.x[v] = coordinate(rng);
+            graph.y[v] = coordinate(rng);
+        }
+    }
+}
+
+std::int64_t Graph::heuristic(int u, int v) const
+{
+    return static_cast<std::int64_t>(std::floor(_euclidean(*this, u, v)));
+}
+
+Graph gridGraph(int width, int height, unsigned seed)
+{
+    std::mt19937 rng(seed);
+
+    Graph graph;
+    graph.name = "grid";
+    graph.n = width * height;
+    graph.x.resize(graph.n);
+    graph.y.resize(graph.n);
+
+    for (int row = 0; row < height; ++row)
+    {
+        for (int column = 0; column < width; ++column)
+        {
+            graph.x[row * width + column] = 100.0 * column;
+            graph.y[row * width + column] = 100.0 * row;
+        }
+    }
+
+    std::vector<Edge> edges;
+    edges.reserve(2 * graph.n);
+
+    for (int row = 0; row < height; ++row)
+    {
+        for (int column = 0; column < width; ++column)
+        {
+            int v = row * width + column;
+
+            if (column + 1 < width)
+            {
+                _addEdge(edges, graph, rng, v, v + 1);
+            }
+
+            if (row + 1 < height)
+            {
+                _addEdge(edges, graph, rng, v, v + width);
+            }
+        }
+    }
+
+    _buildAdjacency(graph, edges);
+
+    return graph;
+}
+
+Graph randomGraph(int n, int degree, unsigned seed)
+{
+    std::mt19937 rng(seed);
+
+    Graph graph;
+    graph.name = "random";
+    graph.n = n;
+    _randomCoordinates(graph, rng);
+
+    std::vector<Edge> edges;
+    edges.reserve(static_cast<std::size_t>(n) * degree);
+
+    // random hamiltonian path for connectivity
+    std::vector<int> permutation(n);
+    for (int v = 0; v < n; ++v)
+    {
+        permutation[v] = v;
+    }
+    std::shuffle(permutation.begin(), permutation.end(), rng);
+
+    for (int i = 0; i + 1 < n; ++i)
+    {
+        _addEdge(edges, graph, rng, permutation[i], permutation[i + 1]);
+    }
+
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    for (std::int64_t i = n - 1; i < static_cast<std::int64_t>(n) * degree; ++i)
+    {
+        _addEdge(edges, graph, rng, vertex(rng), vertex(rng));
+    }
+
+    _buildAdjacency(graph, edges);
+
+    return graph;
+}
+
+Graph powerLawGraph(int n, int edgesPerNode, unsigned seed)
+{
+    std::mt19937 rng(seed);
+
+    Graph graph;
+    graph.name = "power-law";
+    graph.n = n;
+    _randomCoordinates(graph, rng);
+
+    std::vector<Edge> edges;
+    edges.reserve(static_cast<std::size_t>(n) * edgesPerNode);
+
+    // every vertex appears once per incident edge
+    std::vector<int> endpoints;
+    endpoints.reserve(2 * static_cast<std::size_t>(n) * edgesPerNode);
+
+    // start with a clique
+    int initial = std::min(n, edgesPerNode + 1);
+    for (int u = 0; u < initial; ++u)
+    {
+        for (int v = u + 1; v < initial; ++v)
+        {
+            _addEdge(edges, graph, rng, u, v);
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+
+    for (int v = initial; v < n; ++v)
+    {
+        for (int i = 0; i < edgesPerNode; ++i)
+        {
+            int u = endpoints[rng() % endpoints.size()];
+
+            _addEdge(edges, graph, rng, u, v);
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+
+    _buildAdjacency(graph, edges);
+
+    return graph;
+}
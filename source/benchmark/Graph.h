@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Undirected, weighted graph in compressed sparse row format.
+ *
+ * Every vertex has coordinates in the plane and every edge weight is at 
+ * least the euclidean distance of its end points, such that the distance 
+ * returned by `heuristic` is a consistent lower bound for A* searches.
+ */
+struct Graph
+{
+    std::string name;
+
+    int n;
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<std::int64_t> weights;
+
+    std::vector<double> x;
+    std::vector<double> y;
+
+    /**
+     * @brief Gets the index of the first edge leaving a vertex.
+     * 
+     * @param v The vertex
+     * @return Index of the first outgoing edge of `v`
+     */
+    int begin(int v) const
+    {
+        return offsets[v];
+    }
+
+    /**
+     * @brief Gets the index behind the last edge leaving a vertex.
+     * 
+     * @param v The vertex
+     * @return Index behind the last outgoing edge of `v`
+     */
+    int end(int v) const
+    {
+        return offsets[v + 1];
+    }
+
+    /**
+     * @brief Determines the number of directed edges of the graph.
+     * 
+     * @return Twice the number of undirected edges
+     */
+    int edges() const
+    {
+        return static_cast<int>(targets.size());
+    }
+
+    /**
+     * @brief Lower bound of the distance between two vertices.
+     *
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @param u The first vertex
+     * @param v The second vertex
+     * @return The rounded down euclidean distance of `u` and `v`
+     */
+    std::int64_t heuristic(int u, int v) const;
+};
+
+/**
+ * @brief Generates a grid graph with 4-neighbourhoods.
+ * 
+ * @param width Number of columns
+ * @param height Number of rows
+ * @param seed Seed of the random edge weights
+ * @return The generated graph
+ */
+Graph gridGraph(int width, int height, unsigned seed);
+
+/**
+ * @brief Generates a connected random graph with uniformly chosen edges.
+ *
+ * A random hamiltonian path guarantees connectivity, all further edges 
+ * connect uniformly chosen vertices.
+ * 
+ * @param n Number of vertices
+ * @param degree Average number of undirected edges per vertex
+ * @param seed Seed of the generator
+ * @return The generated graph
+ */
+Graph randomGraph(int n, int degree, unsigned seed);
+
+/**
+ * @brief Generates a connected graph with power-law degree distribution.
+ *
+ * Uses preferential attachment: every new vertex connects to `edgesPerNode` 
+ * existing vertices chosen with probability proportional to their degree.
+ * 
+ * @param n Number of vertices
+ * @param edgesPerNode Number of edges added with every vertex
+ * @param seed Seed of the generator
+ * @return The generated graph
+ */
+Graph powerLawGraph(int n, int edgesPerNode, unsigned seed);
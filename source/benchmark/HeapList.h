@@ -0,0 +1,74 @@
+#pragma once
+
+#include "LazyQueue.h"
+
+#include "../FibonacciHeap/FibonacciHeap.h"
+#include "../PairingHeap/PairingHeap.h"
+#include "../SlimPairingHeap/SlimPairingHeap.h"
+#include "../RankPairingHeap/RankPairingHeap.h"
+#include "../HollowHeap/HollowHeap.h"
+#include "../CompactFibonacciHeap/CompactFibonacciHeap.h"
+#include "../CompactPairingHeap/CompactPairingHeap.h"
+#include "../DAryHeap/DAryHeap.h"
+#include "../RadixHeap/RadixHeap.h"
+#include "../BucketQueue/BucketQueue.h"
+
+#include <functional>
+#include <type_traits>
+
+/**
+ * @brief Type trait for heaps which require monotone keys.
+ *
+ * Monotone heaps only support keys which are not smaller than the last
+ * deleted key, or like bucket queues keys from a bounded range. They are
+ * skipped for Prim's algorithm.
+ */
+template<class Heap>
+struct IsMonotone : std::false_type
+{
+};
+
+template<class V, class K>
+struct IsMonotone<RadixHeap<V, K>> : std::true_type
+{
+};
+
+template<class V, class K>
+struct IsMonotone<BucketQueue<V, K>> : std::true_type
+{
+};
+
+/**
+ * @brief Calls `visitor.visit<Heap>(name)` for every heap to compare.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @param visitor The visitor to call
+ */
+template<class V, class K, class Visitor>
+void forEachHeap(Visitor& visitor)
+{
+    typedef std::less<K> Less;
+
+    visitor.template visit<LazyQueue<V, K>>("std::priority_queue");
+    visitor.template visit<FibonacciHeap<V, K>>("FibonacciHeap");
+    visitor.template visit<PairingHeap<V, K>>("PairingHeap");
+    visitor.template visit<PairingHeap<V, K, Less, TwoPassPairing>>(
+        "Pairing<TwoPass>");
+    visitor.template visit<PairingHeap<V, K, Less, MultipassPairing>>(
+        "Pairing<Multipass>");
+    visitor.template visit<PairingHeap<V, K, Less, AuxiliaryTwoPassPairing>>(
+        "Pairing<AuxTwoPass>");
+    visitor.template visit<SlimPairingHeap<V, K>>("SlimPairing<TwoPass>");
+    visitor.template visit<SlimPairingHeap<V, K, Less, MultipassPairing>>(
+        "SlimPairing<Multipass>");
+    visitor.template visit<RankPairingHeap<V, K, 1>>("RankPairing<1>");
+    visitor.template visit<RankPairingHeap<V, K, 2>>("RankPairing<2>");
+    visitor.template visit<HollowHeap<V, K>>("HollowHeap");
+    visitor.template visit<CompactFibonacciHeap<V, K>>(
+        "CompactFibonacciHeap");
+    visitor.template visit<CompactPairingHeap<V, K>>("CompactPairingHeap");
+    visitor.template visit<DAryHeap<V, K, 4>>("DAryHeap<4>");
+    visitor.template visit<DAryHeap<V, K, 8>>("DAryHeap<8>");
+    visitor.template visit<RadixHeap<V, K>>("RadixHeap");
+}
@@ -0,0 +1,107 @@
+#include "LatencyHistogram.h"
+
+#include "../util/Bits.h"
+
+#include <limits>
+
+namespace
+{
+    const int SUB_BUCKETS = 1 << LatencyHistogram::SUB_BITS;
+
+    // exact values below 2 * SUB_BUCKETS, then SUB_BUCKETS per power of two
+    const int BUCKETS = (std::numeric_limits<std::uint64_t>::digits
+        - LatencyHistogram::SUB_BITS + 1) * SUB_BUCKETS;
+}
+
+LatencyHistogram::LatencyHistogram()
+: counts(BUCKETS, 0)
+{
+    reset();
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (int i = 0; i < BUCKETS; ++i)
+    {
+        counts[i] += other.counts[i];
+    }
+
+    if (other.total)
+    {
+        minimum = (other.minimum < minimum) ? other.minimum : minimum;
+        maximum = (other.maximum > maximum) ? other.maximum : maximum;
+    }
+
+    total += other.total;
+    sum += other.sum;
+}
+
+void LatencyHistogram::reset()
+{
+    counts.assign(BUCKETS, 0);
+
+    total = 0;
+    minimum = std::numeric_limits<std::uint64_t>::max();
+    maximum = 0;
+    sum = 0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double q) const
+{
+    if (!total)
+    {
+        return 0;
+    }
+
+    // rank of the percentile among all values, starting at 1
+    std::uint64_t rank = static_cast<std::uint64_t>(q * total);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+    if (rank > total)
+    {
+        rank = total;
+    }
+
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+        {
+            std::uint64_t value = _highest(i);
+
+            return (value < maximum) ? value : maximum;
+        }
+    }
+
+    return maximum;
+}
+
+int LatencyHistogram::_index(std::uint64_t value)
+{
+    if (value < 2 * SUB_BUCKETS)
+    {
+        return static_cast<int>(value);
+    }
+
+    // keep the SUB_BITS bits below the highest set bit
+    int shift = highestBit(value) - SUB_BITS;
+
+    return (shift + 1) * SUB_BUCKETS
+        + static_cast<int>((value >> shift) - SUB_BUCKETS);
+}
+
+std::uint64_t LatencyHistogram::_highest(int index)
+{
+    if (index < 2 * SUB_BUCKETS)
+    {
+        return static_cast<std::uint64_t>(index);
+    }
+
+    int shift = index / SUB_BUCKETS - 1;
+    std::uint64_t sub = index % SUB_BUCKETS + SUB_BUCKETS;
+
+    return ((sub + 1) << shift) - 1;
+}
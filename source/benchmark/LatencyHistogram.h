@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Histogram of latencies with bounded relative error.
+ *
+ * As in HDR histograms, values are counted in buckets of logarithmic width:
+ * values below `2^(SUB_BITS + 1)` are counted exactly, larger values in one
+ * of `2^SUB_BITS` linear sub-buckets per power of two. Hence, every
+ * percentile is reported with a relative error below `2^-SUB_BITS`, about 3
+ * percent, while the histogram takes constant space for any value range.
+ *
+ * Recording a value takes constant time and never allocates.
+ */
+class LatencyHistogram
+{
+public:
+    static const int SUB_BITS = 5;
+
+private:
+    std::vector<std::uint64_t> counts;
+
+    std::uint64_t total;
+    std::uint64_t minimum;
+    std::uint64_t maximum;
+    double sum;
+
+public:
+    /**
+     * @brief Constructs an empty histogram.
+     *
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Counts a value.
+     *
+     * @param value The value to count, e.g. a latency in nanoseconds
+     */
+    void record(std::uint64_t value)
+    {
+        ++counts[_index(value)];
+        ++total;
+        sum += static_cast<double>(value);
+
+        if (value < minimum)
+        {
+            minimum = value;
+        }
+        if (value > maximum)
+        {
+            maximum = value;
+        }
+    }
+
+    /**
+     * @brief Adds the counts of another histogram.
+     *
+     * @param other The histogram to add
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * @brief Removes all counts.
+     *
+     */
+    void reset();
+
+    /**
+     * @brief Determines the number of counted values.
+     *
+     * @return The number of values
+     */
+    std::uint64_t count() const
+    {
+        return total;
+    }
+
+    /**
+     * @brief Determines the smallest counted value.
+     *
+     * @return The smallest value, 0 if the histogram is empty
+     */
+    std::uint64_t min() const
+    {
+        return total ? minimum : 0;
+    }
+
+    /**
+     * @brief Determines the largest counted value.
+     *
+     * @return The largest value, 0 if the histogram is empty
+     */
+    std::uint64_t max() const
+    {
+        return maximum;
+    }
+
+    /**
+     * @brief Determines the mean of all counted values.
+     *
+     * @return The mean value, 0 if the histogram is empty
+     */
+    double mean() const
+    {
+        return total ? sum / total : 0;
+    }
+
+    /**
+     * @brief Determines a percentile of the counted values.
+     *
+     * The result is the largest value of the bucket containing the
+     * percentile, bounded by the largest counted value.
+     *
+     * Runtime: \f$ O(b) \f$ for \f$ b \f$ buckets
+     *
+     * @param q The percentile as a fraction within `[0, 1]`, e.g. 0.99
+     * @return The value at the percentile, 0 if the histogram is empty
+     */
+    std::uint64_t percentile(double q) const;
+
+private:
+    static int _index(std::uint64_t value);
+
+    static std::uint64_t _highest(int index);
+};
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "../interface/HeapBase.h"
+
+#include <cassert>
+#include <cstddef>
+#include <queue>
+#include <vector>
+
+/**
+ * @brief Template for priority queues based on `std::priority_queue` with 
+ * lazy deletion.
+ *
+ * Serves as baseline of the benchmarks. Decreasing a key pushes another 
+ * entry with the new key, removing an element only marks it as removed. 
+ * Stale entries are skipped once they reach the top of the queue.
+ *
+ * Handles are indices into a table of the current key of every element.
+ * 
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+class LazyQueue : public HeapBase<LazyQueue<V, K>, V, K, std::size_t>
+{
+private:
+    struct Entry
+    {
+        K key;
+        std::size_t handle;
+
+        bool operator<(const Entry& other) const
+        {
+            // std::priority_queue is a max-heap
+            return other.key < key;
+        }
+    };
+
+    struct Element
+    {
+        V value;
+        K key;
+        bool alive;
+    };
+
+    // std::priority_queue with access to its container to reserve it
+    struct Queue : public std::priority_queue<Entry>
+    {
+        void reserve(std::size_t n)
+        {
+            this->c.reserve(n);
+        }
+    };
+
+    Queue queue;
+    std::vector<Element> elements;
+    int count;
+
+public:
+    /**
+     * @brief Constructs a new, empty queue.
+     * 
+     */
+    LazyQueue()
+    : count(0)
+    {
+    }
+
+    /**
+     * @brief Reserves space for a number of elements.
+     *
+     * Neither the queue nor the element table grow until more than `n` 
+     * elements are inserted. Decreasing a key pushes another entry, which may 
+     * grow the queue.
+     *
+     * @param n Number of elements to reserve space for
+     */
+    void reserve(std::size_t n)
+    {
+        queue.reserve(n);
+        elements.reserve(n);
+    }
+
+    /**
+     * @brief Determines the number of live elements.
+     * 
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @return The current size of the queue
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * @brief Inserts a key-value-pair into the queue.
+     * 
+     * Runtime: \f$ O(\log n) \f$
+     * 
+     * @param element Value to insert
+     * @param key Key associated with `element`
+     * @return Handle of the inserted element
+     */
+    std::size_t insert(V element, K key)
+    {
+        Element entry = { element, key, true };
+        elements.push_back(entry);
+
+        _push(key, elements.size() - 1);
+        ++count;
+
+        return elements.size() - 1;
+    }
+
+    /**
+     * @brief Determines the value of the element with the smallest key.
+     * 
+     * Runtime: \f$ O(\log n) \f$ amortized
+     * 
+     * @return Value of the smallest element
+     */
+    V min()
+    {
+        _skipStale();
+
+        return elements[queue.top().handle].value;
+    }
+
+    /**
+     * @brief Deletes the element with the smallest key and returns its value.
+     * 
+     * Runtime: \f$ O(\log n) \f$ amortized
+     * 
+     * @return Value of the smallest element
+     */
+    V deleteMin()
+    {
+        _skipStale();
+
+        Element& element = elements[queue.top().handle];
+        queue.pop();
+
+        element.alive = false;
+        --count;
+
+        return element.value;
+    }
+
+    /**
+     * @brief Marks an element as removed.
+     * 
+     * Runtime: \f$ O(1) \f$
+     * 
+     * @param handle Handle of the element to remove
+     * @return Value of the removed element
+     */
+    V remove(std::size_t handle)
+    {
+        assert(elements[handle].alive);
+
+        elements[handle].alive = false;
+        --count;
+
+        return elements[handle].value;
+    }
+
+    /**
+     * @brief Decreases the key of an element by pushing another entry.
+     * 
+     * Runtime: \f$ O(\log n) \f$
+     * 
+     * @param handle Handle of the element
+     * @param key New key of the element
+     */
+    void decreaseKey(std::size_t handle, K key)
+    {
+        if (key < elements[handle].key)
+        {
+            elements[handle].key = key;
+            _push(key, handle);
+        }
+    }
+
+    /**
+     * @brief Merges two queues by reinserting all live elements of `other`.
+     *
+     * Handles of `other` become invalid.
+     * 
+     * Runtime: \f$ O(m \log (n + m)) \f$
+     * 
+     * @param other Pointer to the queue to merge with
+     */
+    void merge(LazyQueue<V, K>* other)
+    {
+        for (std::size_t i = 0; i < other->elements.size(); ++i)
+        {
+            if (other->elements[i].alive)
+            {
+                insert(other->elements[i].value, other->elements[i].key);
+            }
+        }
+
+        other->queue = Queue();
+        other->elements.clear();
+        other->count = 0;
+    }
+
+private:
+    void _push(K key, std::size_t handle)
+    {
+        Entry entry = { key, handle };
+        queue.push(entry);
+    }
+
+    void _skipStale()
+    {
+        assert(count > 0);
+
+        // entries are stale if the element is dead or its key decreased
+        while (!elements[queue.top().handle].alive
+            || elements[queue.top().handle].key < queue.top().key)
+        {
+            queue.pop();
+        }
+    }
+};
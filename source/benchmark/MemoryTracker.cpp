@@ -0,0 +1,132 @@
+#include "MemoryTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    // keeps the alignment guarantees of malloc for the returned pointers
+    const std::size_t HEADER = 16;
+
+    std::atomic<std::size_t> currentBytes(0);
+    std::atomic<std::size_t> peakBytes(0);
+    std::atomic<std::size_t> allocationCount(0);
+
+    void* _allocate(std::size_t size)
+    {
+        char* block = static_cast<char*>(std::malloc(size + HEADER));
+        if (!block)
+        {
+            return NULL;
+        }
+
+        *reinterpret_cast<std::size_t*>(block) = size;
+
+        std::size_t bytes = 
+            currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        std::size_t peak = peakBytes.load(std::memory_order_relaxed);
+        while (bytes > peak 
+            && !peakBytes.compare_exchange_weak(peak, bytes, 
+                std::memory_order_relaxed))
+        {
+        }
+
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        return block + HEADER;
+    }
+
+    void _deallocate(void* pointer)
+    {
+        if (!pointer)
+        {
+            return;
+        }
+
+        char* block = static_cast<char*>(pointer) - HEADER;
+        currentBytes.fetch_sub(*reinterpret_cast<std::size_t*>(block), 
+            std::memory_order_relaxed);
+
+        std::free(block);
+    }
+}
+
+std::size_t MemoryTracker::current()
+{
+    return currentBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::peak()
+{
+    return peakBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::allocations()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::resetPeak()
+{
+    peakBytes.store(currentBytes.load(std::memory_order_relaxed), 
+        std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    void* pointer = _allocate(size);
+    if (!pointer)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return _allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return _allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    _deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    _deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    _deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    _deallocate(pointer);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    _deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    _deallocate(pointer);
+}
+#endif
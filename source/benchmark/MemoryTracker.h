@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Tracks heap memory of the benchmark process.
+ *
+ * The benchmark target replaces the global `operator new` and 
+ * `operator delete`, such that every dynamic allocation is accounted for. 
+ * Peak memory is measured relative to the last call of `resetPeak`.
+ */
+class MemoryTracker
+{
+public:
+    /**
+     * @brief Determines the number of bytes currently allocated.
+     * 
+     * @return The number of allocated bytes
+     */
+    static std::size_t current();
+
+    /**
+     * @brief Determines the maximum number of bytes allocated at once since 
+     * the last reset.
+     * 
+     * @return The peak number of allocated bytes
+     */
+    static std::size_t peak();
+
+    /**
+     * @brief Determines the number of allocations performed so far.
+     * 
+     * @return The number of calls to `operator new`
+     */
+    static std::size_t allocations();
+
+    /**
+     * @brief Resets the peak to the number of bytes currently allocated.
+     * 
+     */
+    static void resetPeak();
+};
@@ -0,0 +1,136 @@
+#include "OperationProfile.h"
+
+namespace
+{
+    const double PERCENTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+
+    const char* PERCENTILE_NAMES[] = { "p50", "p90", "p99", "p99.9" };
+
+    const int PERCENTILE_COUNT = 4;
+}
+
+OperationProfile::OperationProfile()
+: cacheCounter(PerfCounter::CACHE_MISSES),
+  branchCounter(PerfCounter::BRANCH_MISSES)
+{
+    for (int i = 0; i < OPERATIONS; ++i)
+    {
+        cacheMisses[i] = 0;
+        branchMisses[i] = 0;
+    }
+}
+
+const char* OperationProfile::name(Operation operation)
+{
+    static const char* names[OPERATIONS] = {
+        "insert", "deleteMin", "decreaseKey", "merge"
+    };
+
+    return names[operation];
+}
+
+double OperationProfile::cacheMissesPerOperation(Operation operation) const
+{
+    std::uint64_t count = latencies[operation].count();
+
+    return count ? static_cast<double>(cacheMisses[operation]) / count : 0;
+}
+
+double OperationProfile::branchMissesPerOperation(Operation operation) const
+{
+    std::uint64_t count = latencies[operation].count();
+
+    return count ? static_cast<double>(branchMisses[operation]) / count : 0;
+}
+
+void OperationProfile::writeCsvHeader(std::FILE* file)
+{
+    std::fprintf(file, "heap,operation,count,mean_ns");
+    for (int i = 0; i < PERCENTILE_COUNT; ++i)
+    {
+        std::fprintf(file, ",%s_ns", PERCENTILE_NAMES[i]);
+    }
+    std::fprintf(file, ",max_ns,cache_misses,branch_misses\n");
+}
+
+void OperationProfile::writeCsv(std::FILE* file, const char* heap) const
+{
+    for (int i = 0; i < OPERATIONS; ++i)
+    {
+        Operation operation = static_cast<Operation>(i);
+        const LatencyHistogram& histogram = latencies[i];
+        if (!histogram.count())
+        {
+            continue;
+        }
+
+        std::fprintf(file, "%s,%s,%llu,%.1f", heap, name(operation),
+            static_cast<unsigned long long>(histogram.count()),
+            histogram.mean());
+        for (int j = 0; j < PERCENTILE_COUNT; ++j)
+        {
+            std::fprintf(file, ",%llu", static_cast<unsigned long long>(
+                histogram.percentile(PERCENTILES[j])));
+        }
+        std::fprintf(file, ",%llu",
+            static_cast<unsigned long long>(histogram.max()));
+
+        if (counters())
+        {
+            std::fprintf(file, ",%.3f,%.3f\n",
+                cacheMissesPerOperation(operation),
+                branchMissesPerOperation(operation));
+        }
+        else
+        {
+            std::fprintf(file, ",,\n");
+        }
+    }
+}
+
+void OperationProfile::writeJson(std::FILE* file, const char* heap) const
+{
+    // heap names contain no characters which require escaping
+    std::fprintf(file, "{\"heap\": \"%s\", \"operations\": {", heap);
+
+    bool first = true;
+    for (int i = 0; i < OPERATIONS; ++i)
+    {
+        Operation operation = static_cast<Operation>(i);
+        const LatencyHistogram& histogram = latencies[i];
+        if (!histogram.count())
+        {
+            continue;
+        }
+
+        std::fprintf(file, "%s\n  \"%s\": {\"count\": %llu, \"mean_ns\": %.1f",
+            first ? "" : ",", name(operation),
+            static_cast<unsigned long long>(histogram.count()),
+            histogram.mean());
+        first = false;
+
+        for (int j = 0; j < PERCENTILE_COUNT; ++j)
+        {
+            std::fprintf(file, ", \"%s_ns\": %llu", PERCENTILE_NAMES[j],
+                static_cast<unsigned long long>(
+                    histogram.percentile(PERCENTILES[j])));
+        }
+        std::fprintf(file, ", \"max_ns\": %llu",
+            static_cast<unsigned long long>(histogram.max()));
+
+        if (counters())
+        {
+            std::fprintf(file,
+                ", \"cache_misses\": %.3f, \"branch_misses\": %.3f}",
+                cacheMissesPerOperation(operation),
+                branchMissesPerOperation(operation));
+        }
+        else
+        {
+            std::fprintf(file,
+                ", \"cache_misses\": null, \"branch_misses\": null}");
+        }
+    }
+
+    std::fprintf(file, "\n}}");
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "LatencyHistogram.h"
+#include "PerfCounter.h"
+
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Latencies and hardware events per type of heap operation.
+ *
+ * A profile records one latency histogram per operation type and, where
+ * `perf_event_open` is available, sums up the last level cache misses and
+ * branch misses of every operation. Profiles are written as CSV rows or JSON
+ * objects, one per operation type, for tracking regressions across runs.
+ *
+ * Counters are started and stopped around every single operation, hence
+ * each operation additionally pays for four system calls, which are not
+ * included in its latency.
+ */
+class OperationProfile
+{
+public:
+    enum Operation
+    {
+        INSERT,
+        DELETE_MIN,
+        DECREASE_KEY,
+        MERGE
+    };
+
+    static const int OPERATIONS = 4;
+
+private:
+    LatencyHistogram latencies[OPERATIONS];
+    std::uint64_t cacheMisses[OPERATIONS];
+    std::uint64_t branchMisses[OPERATIONS];
+
+    PerfCounter cacheCounter;
+    PerfCounter branchCounter;
+
+public:
+    /**
+     * @brief Constructs an empty profile and opens its hardware counters.
+     *
+     */
+    OperationProfile();
+
+    OperationProfile(const OperationProfile&) = delete;
+    OperationProfile& operator=(const OperationProfile&) = delete;
+
+    /**
+     * @brief Gets the name of an operation type.
+     *
+     * @param operation The operation type
+     * @return The name of the operation, e.g. "deleteMin"
+     */
+    static const char* name(Operation operation);
+
+    /**
+     * @brief Checks whether hardware events are counted.
+     *
+     * @return true if both counters could be opened, false otherwise
+     */
+    bool counters() const
+    {
+        return cacheCounter.available() && branchCounter.available();
+    }
+
+    /**
+     * @brief Starts counting hardware events of an operation.
+     *
+     */
+    void start()
+    {
+        cacheCounter.start();
+        branchCounter.start();
+    }
+
+    /**
+     * @brief Stops counting and records an operation.
+     *
+     * @param operation The type of the operation
+     * @param nanoseconds The latency of the operation
+     */
+    void stop(Operation operation, std::uint64_t nanoseconds)
+    {
+        cacheMisses[operation] += cacheCounter.stop();
+        branchMisses[operation] += branchCounter.stop();
+
+        latencies[operation].record(nanoseconds);
+    }
+
+    /**
+     * @brief Gets the latency histogram of an operation type.
+     *
+     * @param operation The operation type
+     * @return The histogram of latencies in nanoseconds
+     */
+    const LatencyHistogram& latency(Operation operation) const
+    {
+        return latencies[operation];
+    }
+
+    /**
+     * @brief Determines the mean cache misses of an operation type.
+     *
+     * @param operation The operation type
+     * @return Cache misses per operation, 0 if not counted
+     */
+    double cacheMissesPerOperation(Operation operation) const;
+
+    /**
+     * @brief Determines the mean branch misses of an operation type.
+     *
+     * @param operation The operation type
+     * @return Branch misses per operation, 0 if not counted
+     */
+    double branchMissesPerOperation(Operation operation) const;
+
+    /**
+     * @brief Writes the header line of CSV profiles.
+     *
+     * @param file The file to write to
+     */
+    static void writeCsvHeader(std::FILE* file);
+
+    /**
+     * @brief Writes one CSV row per recorded operation type.
+     *
+     * Latencies are given in nanoseconds. Hardware events are left empty if
+     * they are not counted.
+     *
+     * @param file The file to write to
+     * @param heap Name of the profiled heap
+     */
+    void writeCsv(std::FILE* file, const char* heap) const;
+
+    /**
+     * @brief Writes the profile as a JSON object.
+     *
+     * The object maps every recorded operation type to its count, mean,
+     * percentiles and maximum in nanoseconds and, if counted, its hardware
+     * events per operation, which are `null` otherwise.
+     *
+     * @param file The file to write to
+     * @param heap Name of the profiled heap
+     */
+    void writeJson(std::FILE* file, const char* heap) const;
+};
@@ -0,0 +1,76 @@
+#include "PerfCounter.h"
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+PerfCounter::PerfCounter(Event event)
+: fd(-1)
+{
+#if defined(__linux__)
+    static const std::uint64_t configs[] = {
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CPU_CYCLES
+    };
+
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[event];
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+    (void) event;
+#endif
+}
+
+PerfCounter::~PerfCounter()
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+#endif
+}
+
+void PerfCounter::start()
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+std::uint64_t PerfCounter::stop()
+{
+    std::uint64_t count = 0;
+
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != sizeof(count))
+        {
+            count = 0;
+        }
+    }
+#endif
+
+    return count;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Counts a hardware event of the calling thread.
+ *
+ * Counters are opened with `perf_event_open` and only count user space 
+ * events. They are unavailable on systems without performance counters, e.g. 
+ * within virtual machines or with a restrictive `perf_event_paranoid` setting, 
+ * in which case `available` returns false and every count is zero.
+ */
+class PerfCounter
+{
+public:
+    enum Event
+    {
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        INSTRUCTIONS,
+        CYCLES
+    };
+
+private:
+    int fd;
+
+public:
+    /**
+     * @brief Opens a counter of a hardware event.
+     * 
+     * @param event The event to count, last level cache misses by default
+     */
+    explicit PerfCounter(Event event = CACHE_MISSES);
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    /**
+     * @brief Closes the counter.
+     * 
+     */
+    ~PerfCounter();
+
+    /**
+     * @brief Checks whether the counter could be opened.
+     * 
+     * @return true if the counter counts events, false otherwise
+     */
+    bool available() const
+    {
+        return fd >= 0;
+    }
+
+    /**
+     * @brief Resets the count to zero and starts counting.
+     * 
+     */
+    void start();
+
+    /**
+     * @brief Stops counting.
+     * 
+     * @return The number of events since the last call of `start`
+     */
+    std::uint64_t stop();
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "OperationProfile.h"
+
+#include "../interface/IHeap.h"
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Template for heaps which profile the operations of another heap.
+ *
+ * The profiled heap implements `IHeap` by forwarding every call to a given
+ * heap. Insertions, deletions of the minimum, decreases of keys and merges
+ * are timed one by one and recorded in an `OperationProfile`, together with
+ * their hardware events. All other operations are forwarded unmeasured.
+ *
+ * Any implementation of `IHeap` can be profiled, e.g. a `HeapAdapter` of a
+ * statically dispatched heap.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ */
+template<class V, class K>
+class ProfiledHeap : public IHeap<V, K>
+{
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    IHeap<V, K>& heap;
+    OperationProfile& profile;
+
+public:
+    /**
+     * @brief Constructs a profiled heap.
+     *
+     * @param heap The heap to forward calls to
+     * @param profile The profile to record operations in
+     */
+    ProfiledHeap(IHeap<V, K>& heap, OperationProfile& profile)
+    : heap(heap), profile(profile)
+    {
+    }
+
+    void build(std::vector<V>& elements, std::vector<K>& keys) override
+    {
+        heap.build(elements, keys);
+    }
+
+    int size() override
+    {
+        return heap.size();
+    }
+
+    INode<V, K>* insert(V element, K key) override
+    {
+        profile.start();
+        Clock::time_point start = Clock::now();
+
+        INode<V, K>* handle = heap.insert(std::move(element), std::move(key));
+
+        profile.stop(OperationProfile::INSERT, _nanoseconds(start));
+
+        return handle;
+    }
+
+    V min() override
+    {
+        return heap.min();
+    }
+
+    V deleteMin() override
+    {
+        profile.start();
+        Clock::time_point start = Clock::now();
+
+        V value = heap.deleteMin();
+
+        profile.stop(OperationProfile::DELETE_MIN, _nanoseconds(start));
+
+        return value;
+    }
+
+    V remove(INode<V, K>* handle) override
+    {
+        return heap.remove(handle);
+    }
+
+    void decreaseKey(INode<V, K>* handle, K key) override
+    {
+        profile.start();
+        Clock::time_point start = Clock::now();
+
+        heap.decreaseKey(handle, key);
+
+        profile.stop(OperationProfile::DECREASE_KEY, _nanoseconds(start));
+    }
+
+    /**
+     * @brief Merges another heap into the profiled heap.
+     *
+     * If `other` is profiled as well, the heap it forwards to is merged.
+     *
+     * @param other Pointer to the heap to merge with
+     */
+    void merge(IHeap<V, K>* other) override
+    {
+        ProfiledHeap<V, K>* profiled = dynamic_cast<ProfiledHeap<V, K>*>(other);
+        IHeap<V, K>* target = profiled ? &profiled->heap : other;
+
+        profile.start();
+        Clock::time_point start = Clock::now();
+
+        heap.merge(target);
+
+        profile.stop(OperationProfile::MERGE, _nanoseconds(start));
+    }
+
+private:
+    static std::uint64_t _nanoseconds(Clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - start).count();
+    }
+};
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Trace.h"
+
+#include "../interface/IHeap.h"
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Template for heaps which record the operations on another heap.
+ *
+ * The recording heap implements `IHeap` by forwarding every call to a given
+ * heap and writes insertions, deletions of the minimum, removals, decreases
+ * of keys and merges to a `TraceWriter`. The trace can be replayed against
+ * every heap of this project with `heaps_replay`.
+ *
+ * Elements are identified by their values, which are therefore required to
+ * be distinct among the elements of all heaps recorded to the same trace.
+ * Elements passed to `build` are recorded as insertions. As every heap
+ * ignores keys which are not smaller, only strict decreases are recorded.
+ *
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for integral key types
+ * @tparam Hash Template parameter for hash functions of values
+ */
+template<class V, class K, class Hash = std::hash<V>>
+class RecordingHeap : public IHeap<V, K>
+{
+    static_assert(std::is_integral<K>::value,
+        "RecordingHeap requires integral keys");
+
+private:
+    struct Element
+    {
+        std::uint32_t id;
+        INode<V, K>* handle;
+        K key;
+    };
+
+    IHeap<V, K>& heap;
+    TraceWriter& trace;
+    std::uint32_t number;
+
+    std::unordered_map<INode<V, K>*, V> values;
+    std::unordered_map<V, Element, Hash> elements;
+
+public:
+    /**
+     * @brief Constructs a recording heap and adds it to a trace.
+     *
+     * @param heap The heap to forward calls to
+     * @param trace The trace to record operations in
+     */
+    RecordingHeap(IHeap<V, K>& heap, TraceWriter& trace)
+    : heap(heap), trace(trace), number(trace.addHeap())
+    {
+    }
+
+    /**
+     * @brief Builds the heap and records an insertion per element.
+     *
+     * @param elements Vector of distinct values to insert
+     * @param keys Vector of keys
+     * @throws std::invalid_argument if a value is already contained
+     */
+    void build(std::vector<V>& elements, std::vector<K>& keys) override
+    {
+        for (std::size_t i = 0; i < elements.size(); ++i)
+        {
+            _check(elements[i]);
+        }
+
+        heap.build(elements, keys);
+
+        for (std::size_t i = 0; i < elements.size(); ++i)
+        {
+            Element element =
+                { trace.insert(number, keys[i]), NULL, keys[i] };
+            this->elements.insert(std::make_pair(elements[i], element));
+        }
+    }
+
+    int size() override
+    {
+        return heap.size();
+    }
+
+    /**
+     * @brief Inserts and records a key-value-pair.
+     *
+     * @param element Value to insert, distinct from all contained values
+     * @param key Key associated with `element`
+     * @return A pointer to the resulting heap node
+     * @throws std::invalid_argument if `element` is already contained
+     */
+    INode<V, K>* insert(V element, K key) override
+    {
+        _check(element);
+
+        typename std::unordered_map<V, Element, Hash>::iterator entry =
+            elements.insert(std::make_pair(element, Element())).first;
+        entry->second.id = trace.insert(number, key);
+        entry->second.key = key;
+        entry->second.handle = heap.insert(std::move(element),
+            std::move(key));
+
+        values.insert(std::make_pair(entry->second.handle, entry->first));
+
+        return entry->second.handle;
+    }
+
+    V min() override
+    {
+        return heap.min();
+    }
+
+    V deleteMin() override
+    {
+        V value = heap.deleteMin();
+
+        typename std::unordered_map<V, Element, Hash>::iterator entry =
+            elements.find(value);
+        assert(entry != elements.end());
+
+        trace.deleteMin(number, entry->second.id);
+        values.erase(entry->second.handle);
+        elements.erase(entry);
+
+        return value;
+    }
+
+    V remove(INode<V, K>* handle) override
+    {
+        assert(values.count(handle));
+
+        trace.remove(number, elements[values[handle]].id);
+        elements.erase(values[handle]);
+        values.erase(handle);
+
+        return heap.remove(handle);
+    }
+
+    void decreaseKey(INode<V, K>* handle, K key) override
+    {
+        assert(values.count(handle));
+
+        // the heap ignores keys which are not smaller, hence so does the trace
+        Element& entry = elements[values[handle]];
+        if (key < entry.key)
+        {
+            trace.decreaseKey(number, entry.id, key);
+            entry.key = key;
+        }
+
+        heap.decreaseKey(handle, key);
+    }
+
+    /**
+     * @brief Merges and records another recording heap.
+     *
+     * @param other Pointer to a heap recorded to the same trace
+     * @throws std::invalid_argument if `other` is not recorded to the same
+     * trace
+     */
+    void merge(IHeap<V, K>* other) override
+    {
+        RecordingHeap<V, K, Hash>* recording =
+            dynamic_cast<RecordingHeap<V, K, Hash>*>(other);
+        if (!recording || &recording->trace != &trace)
+        {
+            throw std::invalid_argument(
+                "only heaps recorded to the same trace can be merged");
+        }
+        if (recording == this)
+        {
+            return;
+        }
+
+        heap.merge(&recording->heap);
+        trace.merge(number, recording->number);
+
+        values.insert(recording->values.begin(), recording->values.end());
+        elements.insert(recording->elements.begin(),
+            recording->elements.end());
+
+        recording->values.clear();
+        recording->elements.clear();
+    }
+
+private:
+    void _check(const V& element)
+    {
+        if (elements.count(element))
+        {
+            throw std::invalid_argument(
+                "values of recorded elements must be distinct");
+        }
+    }
+};
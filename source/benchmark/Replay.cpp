@@ -0,0 +1,264 @@
+#include "Graph.h"
+#include "HeapList.h"
+#include "MemoryTracker.h"
+#include "RecordingHeap.h"
+#include "Trace.h"
+
+#include "../interface/HeapAdapter.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+typedef std::int64_t Key;
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    double _seconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief Replays a trace with every heap.
+     *
+     * The value of every element is the number of its insertion, such that
+     * deleted elements can be mapped back to their ids. If a heap deletes
+     * another element than the recorded one, both have the same key and the
+     * remaining element takes over the id of the deleted one.
+     *
+     * Monotone heaps are skipped if the trace is not monotone, and heaps
+     * whose handles are not pointers if the trace contains merges, as their
+     * handles change. Bucket queues start with the default range and grow
+     * with the spread of keys, unless it exceeds their largest range.
+     */
+    class ReplayBenchmark
+    {
+    private:
+        const std::vector<TraceOperation>& trace;
+        const TraceSummary& summary;
+
+    public:
+        ReplayBenchmark(const std::vector<TraceOperation>& trace,
+            const TraceSummary& summary)
+        : trace(trace), summary(summary)
+        {
+        }
+
+        template<class Heap>
+        void visit(const char* name)
+        {
+            if (IsMonotone<Heap>::value && !summary.monotone)
+            {
+                std::printf("%-22s skipped, keys are not monotone\n", name);
+                return;
+            }
+            if (summary.merges
+                && !std::is_pointer<typename Heap::handle_type>::value)
+            {
+                std::printf("%-22s skipped, handles change on merge\n", name);
+                return;
+            }
+
+            try
+            {
+                _replay<Heap>(name);
+            }
+            catch (const std::out_of_range&)
+            {
+                std::printf("%-22s skipped, keys exceed the range\n", name);
+            }
+        }
+
+    private:
+        template<class Heap>
+        void _replay(const char* name)
+        {
+            typedef typename Heap::handle_type Handle;
+
+            std::vector<Handle> handles(summary.ids);
+            std::vector<Key> keys(summary.ids);
+            std::vector<std::uint32_t> values(summary.ids);
+            std::vector<std::uint32_t> owners;
+            owners.reserve(summary.inserts);
+
+            bool ok = true;
+
+            MemoryTracker::resetPeak();
+            std::size_t before = MemoryTracker::current();
+            Clock::time_point start = Clock::now();
+
+            std::vector<std::unique_ptr<Heap>> heaps(summary.heaps);
+            for (std::size_t i = 0; i < heaps.size(); ++i)
+            {
+                heaps[i].reset(new Heap());
+            }
+
+            for (std::size_t i = 0; i < trace.size(); ++i)
+            {
+                const TraceOperation& operation = trace[i];
+                Heap& heap = *heaps[operation.heap];
+
+                switch (operation.type)
+                {
+                case TraceOperation::INSERT:
+                {
+                    std::uint32_t value =
+                        static_cast<std::uint32_t>(owners.size());
+                    owners.push_back(operation.id);
+
+                    values[operation.id] = value;
+                    keys[operation.id] = operation.key;
+                    handles[operation.id] = heap.insert(value, operation.key);
+                    break;
+                }
+
+                case TraceOperation::DELETE_MIN:
+                {
+                    std::uint32_t id = owners[heap.deleteMin()];
+                    if (id != operation.id)
+                    {
+                        // break ties as recorded
+                        ok = ok && keys[id] == keys[operation.id];
+
+                        handles[id] = handles[operation.id];
+                        values[id] = values[operation.id];
+                        owners[values[id]] = id;
+                    }
+                    break;
+                }
+
+                case TraceOperation::REMOVE:
+                    ok = ok && owners[heap.remove(handles[operation.id])]
+                        == operation.id;
+                    break;
+
+                case TraceOperation::DECREASE_KEY:
+                    keys[operation.id] = operation.key;
+                    heap.decreaseKey(handles[operation.id], operation.key);
+                    break;
+
+                case TraceOperation::MERGE:
+                    heap.merge(heaps[operation.other].get());
+                    break;
+                }
+            }
+
+            double time = _seconds(start);
+            std::size_t peak = MemoryTracker::peak() - before;
+
+            heaps.clear();
+
+            std::printf("%-22s %10.1f %10.2f %12zu  %s\n", name, 1e3 * time,
+                1e-6 * trace.size() / time, peak / 1024, ok ? "ok" : "FAILED");
+        }
+    };
+
+    /**
+     * @brief Records Dijkstra's algorithm on a random graph as sample trace.
+     */
+    void _record(const char* path, int vertices)
+    {
+        Graph graph = randomGraph(vertices, 4, 2);
+
+        TraceWriter trace(path);
+        HeapAdapter<PairingHeap<int, Key>> adapter;
+        RecordingHeap<int, Key> heap(adapter, trace);
+
+        const Key infinity = std::numeric_limits<Key>::max();
+        std::vector<Key> distances(graph.n, infinity);
+        std::vector<INode<int, Key>*> handles(graph.n, NULL);
+
+        distances[0] = 0;
+        handles[0] = heap.insert(0, 0);
+
+        while (heap.size() > 0)
+        {
+            int u = heap.deleteMin();
+            handles[u] = NULL;
+
+            for (int e = graph.begin(u); e < graph.end(u); ++e)
+            {
+                int v = graph.targets[e];
+                Key distance = distances[u] + graph.weights[e];
+
+                if (!(distance < distances[v]))
+                {
+                    continue;
+                }
+
+                if (handles[v])
+                {
+                    heap.decreaseKey(handles[v], distance);
+                }
+                else
+                {
+                    handles[v] = heap.insert(v, distance);
+                }
+
+                distances[v] = distance;
+            }
+        }
+
+        std::printf("recorded %llu operations of Dijkstra on %s to %s\n",
+            static_cast<unsigned long long>(trace.size()),
+            graph.name.c_str(), path);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || (std::strcmp(argv[1], "record") == 0 && argc < 3))
+    {
+        std::fprintf(stderr, "usage: %s <trace>\n"
+            "       %s record <trace> [vertices]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        if (std::strcmp(argv[1], "record") == 0)
+        {
+            _record(argv[2], (argc > 3) ? std::atoi(argv[3]) : 100000);
+            return 0;
+        }
+
+        TraceSummary summary;
+        std::vector<TraceOperation> trace = readTrace(argv[1], summary);
+
+        std::printf("%llu operations on %u heaps: %llu insert, "
+            "%llu deleteMin, %llu remove, %llu decreaseKey, %llu merge%s\n\n",
+            static_cast<unsigned long long>(summary.operations()),
+            summary.heaps,
+            static_cast<unsigned long long>(summary.inserts),
+            static_cast<unsigned long long>(summary.deleteMins),
+            static_cast<unsigned long long>(summary.removes),
+            static_cast<unsigned long long>(summary.decreaseKeys),
+            static_cast<unsigned long long>(summary.merges),
+            summary.monotone ? ", monotone" : "");
+
+        std::printf("%-22s %10s %10s %12s  %s\n", "heap", "time [ms]",
+            "Mops/s", "peak [KiB]", "check");
+
+        ReplayBenchmark benchmark(trace, summary);
+        forEachHeap<std::uint32_t, Key>(benchmark);
+        benchmark.visit<BucketQueue<std::uint32_t, Key>>("BucketQueue");
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,315 @@
+#include "Trace.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    const char MAGIC[8] = { 'H', 'E', 'A', 'P', 'T', 'R', 'C', '1' };
+
+    std::uint64_t _zigzag(std::int64_t value)
+    {
+        return (static_cast<std::uint64_t>(value) << 1)
+            ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    std::int64_t _unzigzag(std::uint64_t value)
+    {
+        return static_cast<std::int64_t>(value >> 1)
+            ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    /**
+     * @brief Reads the records of a trace from a file.
+     */
+    class Reader
+    {
+    private:
+        std::FILE* file;
+        const char* path;
+
+    public:
+        Reader(const char* path)
+        : file(std::fopen(path, "rb")), path(path)
+        {
+            if (!file)
+            {
+                fail("cannot open");
+            }
+        }
+
+        ~Reader()
+        {
+            std::fclose(file);
+        }
+
+        void header()
+        {
+            char magic[sizeof(MAGIC)];
+            if (std::fread(magic, 1, sizeof(magic), file) != sizeof(magic)
+                || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+            {
+                fail("invalid header in");
+            }
+        }
+
+        bool type(TraceOperation::Type& type)
+        {
+            int c = std::getc(file);
+            if (c == EOF)
+            {
+                return false;
+            }
+            if (c > TraceOperation::MERGE)
+            {
+                fail("invalid record in");
+            }
+
+            type = static_cast<TraceOperation::Type>(c);
+
+            return true;
+        }
+
+        std::uint64_t value()
+        {
+            std::uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                int c = std::getc(file);
+                if (c == EOF)
+                {
+                    fail("truncated record in");
+                }
+
+                value |= static_cast<std::uint64_t>(c & 0x7f) << shift;
+                if (!(c & 0x80))
+                {
+                    return value;
+                }
+            }
+
+            fail("invalid record in");
+        }
+
+        std::uint32_t index()
+        {
+            std::uint64_t index = value();
+            if (index > std::numeric_limits<std::uint32_t>::max())
+            {
+                fail("invalid record in");
+            }
+
+            return static_cast<std::uint32_t>(index);
+        }
+
+        [[noreturn]] void fail(const char* message)
+        {
+            throw std::runtime_error(std::string(message) + " trace file "
+                + path);
+        }
+    };
+}
+
+TraceWriter::TraceWriter(const char* path)
+: file(std::fopen(path, "wb")), heaps(0), next(0), operations(0)
+{
+    if (!file)
+    {
+        throw std::runtime_error(std::string("cannot create trace file ")
+            + path);
+    }
+
+    std::fwrite(MAGIC, 1, sizeof(MAGIC), file);
+}
+
+TraceWriter::~TraceWriter()
+{
+    std::fclose(file);
+}
+
+std::uint32_t TraceWriter::insert(std::uint32_t heap, std::int64_t key)
+{
+    std::uint32_t id;
+    if (released.empty())
+    {
+        id = next++;
+    }
+    else
+    {
+        id = released.back();
+        released.pop_back();
+    }
+
+    _operation(TraceOperation::INSERT, heap);
+    _write(id);
+    _write(_zigzag(key));
+
+    return id;
+}
+
+void TraceWriter::deleteMin(std::uint32_t heap, std::uint32_t id)
+{
+    _operation(TraceOperation::DELETE_MIN, heap);
+    _write(id);
+    _release(id);
+}
+
+void TraceWriter::remove(std::uint32_t heap, std::uint32_t id)
+{
+    _operation(TraceOperation::REMOVE, heap);
+    _write(id);
+    _release(id);
+}
+
+void TraceWriter::decreaseKey(std::uint32_t heap, std::uint32_t id,
+    std::int64_t key)
+{
+    _operation(TraceOperation::DECREASE_KEY, heap);
+    _write(id);
+    _write(_zigzag(key));
+}
+
+void TraceWriter::merge(std::uint32_t heap, std::uint32_t other)
+{
+    _operation(TraceOperation::MERGE, heap);
+    _write(other);
+}
+
+void TraceWriter::_operation(TraceOperation::Type type, std::uint32_t heap)
+{
+    std::putc(type, file);
+    _write(heap);
+
+    ++operations;
+}
+
+void TraceWriter::_release(std::uint32_t id)
+{
+    released.push_back(id);
+}
+
+void TraceWriter::_write(std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        std::putc(static_cast<int>(value & 0x7f) | 0x80, file);
+        value >>= 7;
+    }
+    std::putc(static_cast<int>(value), file);
+}
+
+std::vector<TraceOperation> readTrace(const char* path, TraceSummary& summary)
+{
+    Reader reader(path);
+    reader.header();
+
+    std::vector<TraceOperation> trace;
+    std::vector<std::int64_t> keys;
+    std::vector<char> alive;
+
+    summary = TraceSummary();
+    std::int64_t last = std::numeric_limits<std::int64_t>::min();
+
+    TraceOperation operation;
+    while (reader.type(operation.type))
+    {
+        operation.heap = reader.index();
+        operation.other = 0;
+        operation.id = 0;
+        operation.key = 0;
+
+        if (operation.type == TraceOperation::MERGE)
+        {
+            operation.other = reader.index();
+            if (operation.other == operation.heap)
+            {
+                reader.fail("self-merge in");
+            }
+            if (operation.other >= summary.heaps)
+            {
+                summary.heaps = operation.other + 1;
+            }
+            ++summary.merges;
+        }
+        else
+        {
+            operation.id = reader.index();
+            if (operation.id >= alive.size())
+            {
+                // ids are assigned densely, see TraceWriter
+                if (operation.type != TraceOperation::INSERT
+                    || operation.id != alive.size())
+                {
+                    reader.fail("unknown id in");
+                }
+                keys.push_back(0);
+                alive.push_back(0);
+            }
+
+            bool inserted = operation.type == TraceOperation::INSERT;
+            if ((alive[operation.id] != 0) == inserted)
+            {
+                reader.fail("invalid use of id in");
+            }
+        }
+
+        switch (operation.type)
+        {
+        case TraceOperation::INSERT:
+        case TraceOperation::DECREASE_KEY:
+            operation.key = _unzigzag(reader.value());
+            if (operation.type == TraceOperation::DECREASE_KEY
+                && keys[operation.id] < operation.key)
+            {
+                reader.fail("increased key in");
+            }
+            if (operation.key < last)
+            {
+                summary.monotone = false;
+            }
+
+            if (operation.type == TraceOperation::INSERT)
+            {
+                ++summary.inserts;
+            }
+            else
+            {
+                ++summary.decreaseKeys;
+            }
+
+            keys[operation.id] = operation.key;
+            alive[operation.id] = 1;
+            break;
+
+        case TraceOperation::DELETE_MIN:
+        case TraceOperation::REMOVE:
+            if (operation.type == TraceOperation::DELETE_MIN)
+            {
+                last = keys[operation.id];
+                ++summary.deleteMins;
+            }
+            else
+            {
+                ++summary.removes;
+            }
+
+            alive[operation.id] = 0;
+            break;
+
+        case TraceOperation::MERGE:
+            break;
+        }
+
+        if (operation.heap >= summary.heaps)
+        {
+            summary.heaps = operation.heap + 1;
+        }
+        trace.push_back(operation);
+    }
+
+    summary.ids = static_cast<std::uint32_t>(alive.size());
+
+    return trace;
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @brief A single recorded heap operation.
+ *
+ * Elements are identified by ids, which are reused once their element has
+ * been deleted, and heaps by the order in which they were added to the
+ * trace. Depending on the type, some fields are unused:
+ *
+ * - `INSERT`: `heap`, `id`, `key`
+ * - `DELETE_MIN`: `heap`, `id` of the deleted element
+ * - `REMOVE`: `heap`, `id`
+ * - `DECREASE_KEY`: `heap`, `id`, `key`
+ * - `MERGE`: `heap`, `other` heap merged into `heap`
+ */
+struct TraceOperation
+{
+    enum Type
+    {
+        INSERT,
+        DELETE_MIN,
+        REMOVE,
+        DECREASE_KEY,
+        MERGE
+    };
+
+    Type type;
+    std::uint32_t heap;
+    std::uint32_t other;
+    std::uint32_t id;
+    std::int64_t key;
+};
+
+/**
+ * @brief Writes heap operations to a binary trace file.
+ *
+ * A trace starts with a header of eight bytes, followed by one record per
+ * operation: a byte for its type and its fields as variable-length
+ * integers, seven bits per byte, keys in zigzag encoding. Typical records
+ * take three to six bytes.
+ *
+ * The writer assigns the ids of inserted elements, preferring the most
+ * recently released id, such that ids stay below the maximum number of
+ * elements at once.
+ */
+class TraceWriter
+{
+private:
+    std::FILE* file;
+
+    std::uint32_t heaps;
+    std::uint32_t next;
+    std::vector<std::uint32_t> released;
+
+    std::uint64_t operations;
+
+public:
+    /**
+     * @brief Creates a trace file.
+     *
+     * @param path Path of the file, which is overwritten
+     * @throws std::runtime_error if the file cannot be created
+     */
+    explicit TraceWriter(const char* path);
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    /**
+     * @brief Flushes and closes the trace file.
+     *
+     */
+    ~TraceWriter();
+
+    /**
+     * @brief Adds a heap to the trace.
+     *
+     * @return The number of the heap within the trace
+     */
+    std::uint32_t addHeap()
+    {
+        return heaps++;
+    }
+
+    /**
+     * @brief Records an insertion.
+     *
+     * @param heap The heap to insert into
+     * @param key The key of the inserted element
+     * @return The id of the inserted element
+     */
+    std::uint32_t insert(std::uint32_t heap, std::int64_t key);
+
+    /**
+     * @brief Records a deletion of the minimum.
+     *
+     * @param heap The heap to delete from
+     * @param id The id of the deleted element, which is released
+     */
+    void deleteMin(std::uint32_t heap, std::uint32_t id);
+
+    /**
+     * @brief Records a removal.
+     *
+     * @param heap The heap to remove from
+     * @param id The id of the removed element, which is released
+     */
+    void remove(std::uint32_t heap, std::uint32_t id);
+
+    /**
+     * @brief Records a decrease of a key.
+     *
+     * @param heap The heap containing the element
+     * @param id The id of the element
+     * @param key The new key of the element
+     */
+    void decreaseKey(std::uint32_t heap, std::uint32_t id, std::int64_t key);
+
+    /**
+     * @brief Records a merge.
+     *
+     * @param heap The heap to merge into
+     * @param other The heap which is merged and left empty
+     */
+    void merge(std::uint32_t heap, std::uint32_t other);
+
+    /**
+     * @brief Determines the number of recorded operations.
+     *
+     * @return The number of operations
+     */
+    std::uint64_t size() const
+    {
+        return operations;
+    }
+
+private:
+    void _operation(TraceOperation::Type type, std::uint32_t heap);
+
+    void _release(std::uint32_t id);
+
+    void _write(std::uint64_t value);
+};
+
+/**
+ * @brief Summary of a trace, collected while reading it.
+ */
+struct TraceSummary
+{
+    std::uint32_t heaps;
+    std::uint32_t ids;
+    std::uint64_t inserts;
+    std::uint64_t deleteMins;
+    std::uint64_t removes;
+    std::uint64_t decreaseKeys;
+    std::uint64_t merges;
+
+    // whether no key is smaller than the last deleted key
+    bool monotone;
+
+    TraceSummary()
+    : heaps(0), ids(0), inserts(0), deleteMins(0), removes(0),
+      decreaseKeys(0), merges(0), monotone(true)
+    {
+    }
+
+    std::uint64_t operations() const
+    {
+        return inserts + deleteMins + removes + decreaseKeys + merges;
+    }
+};
+
+/**
+ * @brief Reads a binary trace file written by `TraceWriter`.
+ *
+ * Runtime: \f$ O(m) \f$ for \f$ m \f$ operations
+ *
+ * @param path Path of the trace file
+ * @param summary Summary of the trace
+ * @return The operations of the trace in order
+ * @throws std::runtime_error if the file cannot be read or is no valid
+ * trace, e.g. if it refers to ids which are not in use
+ */
+std::vector<TraceOperation> readTrace(const char* path, TraceSummary& summary);
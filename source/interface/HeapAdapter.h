@@ -0,0 +1,108 @@
+#pragma once
+
+#include "IHeap.h"
+#include "HeapBase.h"
+
+#include <cassert>
+#include <utility>
+
+/**
+ * @brief Template for type-erased adapters of statically dispatched heaps.
+ *
+ * The adapter owns a heap of type `Heap` and implements `IHeap` by forwarding
+ * every call to it. Handles of the heap are required to point to nodes
+ * derived from `INode`, such that they can be passed through `IHeap` as
+ * opaque handles.
+ *
+ * Only callers which require runtime polymorphism should use the adapter;
+ * generic code templated on the heap type calls the heap directly.
+ *
+ * @tparam Heap Template parameter for the adapted heap type
+ */
+template<class Heap>
+class HeapAdapter
+: public IHeap<typename Heap::value_type, typename Heap::key_type>
+{
+    static_assert(IsHeap<Heap>::value,
+        "HeapAdapter requires a type implementing the heap interface");
+
+public:
+    typedef typename Heap::value_type V;
+    typedef typename Heap::key_type K;
+    typedef typename Heap::handle_type Handle;
+
+private:
+    Heap heap;
+
+public:
+    /**
+     * @brief Constructs a new adapter and the adapted heap.
+     *
+     * @param args Arguments passed to the constructor of the heap
+     */
+    template<class... Args>
+    explicit HeapAdapter(Args&&... args)
+    : heap(std::forward<Args>(args)...)
+    {
+    }
+
+    void build(std::vector<V>& elements, std::vector<K>& keys) override
+    {
+        heap.build(elements, keys);
+    }
+
+    int size() override
+    {
+        return heap.size();
+    }
+
+    INode<V, K>* insert(V element, K key) override
+    {
+        return heap.insert(std::move(element), std::move(key));
+    }
+
+    V min() override
+    {
+        return heap.min();
+    }
+
+    V deleteMin() override
+    {
+        return heap.deleteMin();
+    }
+
+    V remove(INode<V, K>* handle) override
+    {
+        return heap.remove(static_cast<Handle>(handle));
+    }
+
+    void decreaseKey(INode<V, K>* handle, K key) override
+    {
+        heap.decreaseKey(static_cast<Handle>(handle), key);
+    }
+
+    /**
+     * @brief Merges two instances of adapted heaps.
+     *
+     * Both heaps must be adapters of the same heap type.
+     *
+     * @param other Pointer to the heap to merge with
+     */
+    void merge(IHeap<V, K>* other) override
+    {
+        HeapAdapter<Heap>* adapter = dynamic_cast<HeapAdapter<Heap>*>(other);
+        assert(adapter);
+
+        heap.merge(&adapter->heap);
+    }
+
+    /**
+     * @brief Gets the adapted heap.
+     *
+     * @return A reference to the adapted heap
+     */
+    Heap& getHeap()
+    {
+        return heap;
+    }
+};
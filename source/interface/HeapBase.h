@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Template base for statically dispatched heap data structures.
+ *
+ * Heaps derive from this base using the curiously recurring template pattern
+ * and implement the following methods directly, without any virtual calls:
+ *
+ * - `int size()`
+ * - `Handle insert(V element, K key)`
+ * - `V min()`
+ * - `V deleteMin()`
+ * - `V remove(Handle handle)`
+ * - `void decreaseKey(Handle handle, K key)`
+ * - `void merge(Derived* other)`
+ *
+ * Heaps may take values and keys of `insert` by const or rvalue reference 
+ * instead, and `min` may return a const reference to the smallest value.
+ *
+ * Generic algorithms are templated on the heap type and may verify this
+ * interface with `IsHeap`. The base provides the member types `value_type`,
+ * `key_type` and `handle_type` as well as default implementations of methods
+ * which can be expressed in terms of the interface above.
+ *
+ * @tparam Derived Template parameter for the implementing heap type
+ * @tparam V Template parameter for value types
+ * @tparam K Template parameter for key types
+ * @tparam Handle Template parameter for handle types returned by `insert`
+ */
+template<class Derived, class V, class K, class Handle>
+class HeapBase
+{
+public:
+    typedef V value_type;
+    typedef K key_type;
+    typedef Handle handle_type;
+
+    /**
+     * @brief Checks whether the heap is empty.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return true if the heap contains no elements, false otherwise
+     */
+    bool empty()
+    {
+        return derived().size() == 0;
+    }
+
+    /**
+     * @brief Builds a heap from a set of values with associated keys.
+     *
+     * Both sets must have the same length. This implementation assumes that
+     * the following property holds for all indices `i`:
+     *
+     * `key[i]` is the key associated with `elements[i]`.
+     *
+     * This implementation inserts every key-value-pair separately.
+     *
+     * @param elements Vector of values to insert
+     * @param keys Vector of keys
+     */
+    void build(std::vector<V>& elements, std::vector<K>& keys)
+    {
+        assert(elements.size() == keys.size());
+
+        for (std::size_t i = 0; i < elements.size(); ++i)
+        {
+            derived().insert(elements[i], keys[i]);
+        }
+    }
+
+protected:
+    HeapBase()
+    {
+    }
+
+    ~HeapBase()
+    {
+    }
+
+    /**
+     * @brief Gets the implementing heap.
+     *
+     * @return A reference to the derived heap
+     */
+    Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+};
+
+/**
+ * @brief Type trait checking the static heap interface of a type.
+ *
+ * `IsHeap<H>::value` is true if `H` provides the member types and methods
+ * listed for `HeapBase`, false otherwise.
+ *
+ * @tparam H Template parameter for the type to check
+ */
+template<class H>
+class IsHeap
+{
+private:
+    template<class T>
+    static auto _check(T* heap) -> decltype(
+        (void) heap->size(),
+        (void) heap->empty(),
+        (void) static_cast<typename T::handle_type>(heap->insert(
+            std::declval<typename T::value_type>(),
+            std::declval<typename T::key_type>())),
+        (void) static_cast<typename T::value_type>(heap->min()),
+        (void) static_cast<typename T::value_type>(heap->deleteMin()),
+        (void) heap->remove(std::declval<typename T::handle_type>()),
+        (void) heap->decreaseKey(
+            std::declval<typename T::handle_type>(),
+            std::declval<typename T::key_type>()),
+        (void) heap->merge(heap),
+        std::true_type());
+
+    template<class T>
+    static std::false_type _check(...);
+
+public:
+    static const bool value = decltype(_check<H>(0))::value;
+};
@@ -16,6 +16,10 @@
  *
  * Any extension of this interface is required to provide implementations of 
  * all of the following methods.
+ *
+ * The heap implementations of this project are statically dispatched (see 
+ * `HeapBase`) and implement this interface through `HeapAdapter` for callers 
+ * which require runtime polymorphism.
  * 
  * @tparam V Template parameter for value types
  * @tparam K Template parameter for key types
@@ -23,6 +27,10 @@
 template<class V, class K> class IHeap
 {
 public:
+    virtual ~IHeap()
+    {
+    }
+
     /**
      * @brief Builds a heap data structure from a set of values with associated keys.
      *
@@ -1,25 +1,21 @@
 #pragma once
 
 /**
- * @brief Template interface for elements (nodes) of heap data structures.
+ * @brief Template base for elements (nodes) of heap data structures.
+ *
+ * Nodes are handed out as handles by `insert` and passed back to `remove` and 
+ * `decreaseKey`. Through `IHeap`, handles are opaque: this base deliberately 
+ * has no virtual methods, such that nodes do not carry a virtual table 
+ * pointer and calls on concrete node types are resolved statically.
+ *
+ * Concrete node types of tree-based heaps provide the following methods:
+ *
+ * - `bool hasChildren()`: true if the node has any children, false otherwise
+ * - `bool hasParent()`: true if the node has a parent node, false otherwise
  * 
  * @tparam V Template parameter for value types
  * @tparam K Template parameter for key types
  */
 template<class V, class K> struct INode
 {
-public: 
-    /**
-     * @brief Checks whether a heap node has any child nodes.
-     * 
-     * @return true if the node has any children, false otherwise
-     */
-    virtual bool hasChildren() = 0;
-    
-    /**
-     * @brief Checks whether a heap node has a parent node.
-     * 
-     * @return true if the node has a parent node, false otherwise
-     */
-    virtual bool hasParent() = 0;
-};
\ No newline at end of file
+};
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "HeapBase.h"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Template for heaps of dense integer ids with an owned handle table.
+ *
+ * Graph searches store vertex ids in `[0, n)` as values and keep a table
+ * from ids to handles next to the heap. The indexed heap owns this table,
+ * such that elements are addressed by their id instead of their handle:
+ * `decreaseKey(id, key)`, `contains(id)` and `insertOrDecrease(id, key)`.
+ * Every id is contained at most once.
+ *
+ * Storage for all `n` elements is reserved at construction, either through
+ * `reserve(n)` of the heap or through `reserve(n)` of its node pool, hence
+ * no insertion requests memory from the system afterwards. Heaps providing
+ * neither are rejected at compile time.
+ *
+ * @tparam Heap Template parameter for heap types with integral values
+ */
+template<class Heap>
+class IndexedHeap
+{
+    static_assert(IsHeap<Heap>::value,
+        "IndexedHeap requires a type implementing the heap interface");
+
+    static_assert(std::is_integral<typename Heap::value_type>::value,
+        "IndexedHeap requires integral ids as values");
+
+public:
+    typedef typename Heap::value_type V;
+    typedef typename Heap::key_type K;
+    typedef typename Heap::handle_type Handle;
+
+private:
+    Heap heap;
+
+    // handle of every contained id, _none() otherwise
+    std::vector<Handle> handles;
+
+public:
+    /**
+     * @brief Constructs a new indexed heap for the ids `[0, n)`.
+     *
+     * @param n Number of ids
+     * @param args Arguments passed to the constructor of the heap
+     */
+    template<class... Args>
+    explicit IndexedHeap(std::size_t n, Args&&... args)
+    : heap(std::forward<Args>(args)...), handles(n, _none())
+    {
+        _reserve(heap, n, 0);
+    }
+
+    /**
+     * @brief Determines the number of contained ids.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return The current size of the heap
+     */
+    int size()
+    {
+        return heap.size();
+    }
+
+    /**
+     * @brief Checks whether the heap is empty.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @return true if the heap contains no ids, false otherwise
+     */
+    bool empty()
+    {
+        return heap.size() == 0;
+    }
+
+    /**
+     * @brief Checks whether an id is contained in the heap.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param id The id to look up
+     * @return true if `id` is contained, false otherwise
+     */
+    bool contains(V id)
+    {
+        assert(static_cast<std::size_t>(id) < handles.size());
+
+        return handles[id] != _none();
+    }
+
+    /**
+     * @brief Inserts an id which is not contained yet.
+     *
+     * Runtime: as `insert` of the heap
+     *
+     * @param id The id to insert
+     * @param key Key associated with `id`
+     */
+    void insert(V id, K key)
+    {
+        assert(!contains(id));
+
+        handles[id] = heap.insert(id, key);
+    }
+
+    /**
+     * @brief Determines the id with the smallest key.
+     *
+     * Runtime: as `min` of the heap
+     *
+     * @return The id of the smallest element
+     */
+    V min()
+    {
+        return heap.min();
+    }
+
+    /**
+     * @brief Deletes the id with the smallest key.
+     *
+     * Runtime: as `deleteMin` of the heap
+     *
+     * @return The id of the smallest element
+     */
+    V deleteMin()
+    {
+        V id = heap.deleteMin();
+        handles[id] = _none();
+
+        return id;
+    }
+
+    /**
+     * @brief Removes a contained id.
+     *
+     * Runtime: as `remove` of the heap
+     *
+     * @param id The id to remove
+     */
+    void remove(V id)
+    {
+        assert(contains(id));
+
+        heap.remove(handles[id]);
+        handles[id] = _none();
+    }
+
+    /**
+     * @brief Decreases the key of a contained id.
+     *
+     * Keys which are not smaller than the current key are ignored.
+     *
+     * Runtime: as `decreaseKey` of the heap
+     *
+     * @param id The id whose key to decrease
+     * @param key New key of `id`
+     */
+    void decreaseKey(V id, K key)
+    {
+        assert(contains(id));
+
+        heap.decreaseKey(handles[id], key);
+    }
+
+    /**
+     * @brief Inserts an id or decreases its key if it is contained already.
+     *
+     * Runtime: as `insert` or `decreaseKey` of the heap, respectively
+     *
+     * @param id The id to insert or update
+     * @param key New key of `id`
+     * @return true if `id` was inserted, false if its key was decreased
+     */
+    bool insertOrDecrease(V id, K key)
+    {
+        if (contains(id))
+        {
+            heap.decreaseKey(handles[id], key);
+
+            return false;
+        }
+
+        handles[id] = heap.insert(id, key);
+
+        return true;
+    }
+
+    /**
+     * @brief Gets the underlying heap, e.g. to read its statistics.
+     *
+     * Elements must not be inserted or deleted through this reference.
+     *
+     * @return A reference to the heap
+     */
+    Heap& getHeap()
+    {
+        return heap;
+    }
+
+private:
+    template<class H>
+    static auto _reserve(H& heap, std::size_t n, int)
+        -> decltype(heap.reserve(n), void())
+    {
+        heap.reserve(n);
+    }
+
+    template<class H>
+    static auto _reserve(H& heap, std::size_t n, long)
+        -> decltype(heap.getPool()->reserve(n), void())
+    {
+        heap.getPool()->reserve(n);
+    }
+
+    template<class H>
+    static void _reserve(H&, std::size_t, ...)
+    {
+        static_assert(sizeof(H) == 0,
+            "IndexedHeap requires heaps with reserve(n) or getPool()");
+    }
+
+    static Handle _none()
+    {
+        return _none(std::is_pointer<Handle>());
+    }
+
+    static Handle _none(std::true_type)
+    {
+        return NULL;
+    }
+
+    static Handle _none(std::false_type)
+    {
+        return std::numeric_limits<Handle>::max();
+    }
+};
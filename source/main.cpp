@@ -1,8 +1,19 @@
 #include "interface/IHeap.h"
+#include "interface/HeapAdapter.h"
 #include "FibonacciHeap/FibonacciHeap.h"
 #include "PairingHeap/PairingHeap.h"
+#include "SlimPairingHeap/SlimPairingHeap.h"
+#include "RankPairingHeap/RankPairingHeap.h"
+#include "HollowHeap/HollowHeap.h"
+#include "CompactFibonacciHeap/CompactFibonacciHeap.h"
+#include "CompactPairingHeap/CompactPairingHeap.h"
+#include "DAryHeap/DAryHeap.h"
+#include "RadixHeap/RadixHeap.h"
+#include "BucketQueue/BucketQueue.h"
+#include "MultiQueue/MultiQueue.h"
+#include "SequenceHeap/SequenceHeap.h"
 
 int main()
 {
     return 0;
-}
\ No newline at end of file
+}
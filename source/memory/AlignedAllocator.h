@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * @brief Template for allocators returning memory aligned to cache lines.
+ *
+ * Meets the allocator requirements of the standard library containers, e.g.
+ * `std::vector<T, AlignedAllocator<T>>` stores its first element at the start
+ * of a cache line.
+ *
+ * @tparam T Template parameter for element types
+ * @tparam Alignment Template parameter for the alignment in bytes, a power of 
+ * two
+ */
+template<class T, std::size_t Alignment = 64>
+class AlignedAllocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, 
+        "Alignment must be a power of two");
+    static_assert(Alignment >= sizeof(void*), 
+        "Alignment must fit a pointer");
+
+public:
+    typedef T value_type;
+
+    template<class U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    AlignedAllocator()
+    {
+    }
+
+    template<class U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&)
+    {
+    }
+
+    /**
+     * @brief Allocates aligned storage for `n` elements.
+     *
+     * The pointer returned by `operator new` is stored right in front of the 
+     * aligned storage.
+     *
+     * @param n Number of elements
+     * @return A pointer to uninitialized, aligned storage
+     */
+    T* allocate(std::size_t n)
+    {
+        char* raw = static_cast<char*>(
+            ::operator new(n * sizeof(T) + Alignment + sizeof(void*)));
+
+        std::uintptr_t address = 
+            reinterpret_cast<std::uintptr_t>(raw + sizeof(void*));
+        char* aligned = raw + sizeof(void*) 
+            + (Alignment - address % Alignment) % Alignment;
+
+        reinterpret_cast<char**>(aligned)[-1] = raw;
+
+        return reinterpret_cast<T*>(aligned);
+    }
+
+    /**
+     * @brief Releases storage returned by `allocate`.
+     *
+     * @param pointer Pointer to the storage
+     */
+    void deallocate(T* pointer, std::size_t)
+    {
+        ::operator delete(reinterpret_cast<char**>(pointer)[-1]);
+    }
+
+    template<class U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const
+    {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const
+    {
+        return false;
+    }
+};
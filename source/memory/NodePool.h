@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Template for slab allocators of heap nodes.
+ *
+ * Node pools request memory from the system in slabs of many nodes at once
+ * and hand out single nodes from those slabs. Released nodes are kept in a
+ * free list and reused by subsequent allocations, such that a heap in steady
+ * state does not call `new` or `delete` at all.
+ *
+ * All slabs are returned to the system at once when the pool is released or
+ * destroyed. Pools are shared between heaps through `std::shared_ptr`, which
+ * allows nodes to move freely between heaps that are merged.
+ *
+ * The pool only manages raw storage. Constructing and destroying the nodes
+ * is the responsibility of the heap using the pool.
+ *
+ * @tparam T Template parameter for node types
+ */
+template<class T>
+class NodePool
+{
+private:
+    union Block
+    {
+        Block* next;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    std::vector<Block*> slabs;
+    Block* freeList;
+
+    // free lists of spliced pools, used up before adding slabs
+    std::vector<Block*> spareLists;
+
+    std::size_t initialSlabSize;
+    std::size_t slabSize;
+    std::size_t maxSlabSize;
+    std::size_t capacity;
+
+    std::vector<std::shared_ptr<NodePool<T>>> retained;
+
+public:
+    /**
+     * @brief Constructs a new node pool.
+     *
+     * Slabs start with `initialSlabSize` nodes and double in size with every
+     * further slab until `maxSlabSize` nodes are reached.
+     *
+     * @param initialSlabSize Number of nodes in the first slab
+     * @param maxSlabSize Maximum number of nodes per slab
+     */
+    explicit NodePool(std::size_t initialSlabSize = 64,
+        std::size_t maxSlabSize = 65536)
+    : freeList(NULL),
+      initialSlabSize(initialSlabSize),
+      slabSize(initialSlabSize),
+      maxSlabSize(maxSlabSize),
+      capacity(0)
+    {
+        assert(initialSlabSize > 0);
+        assert(initialSlabSize <= maxSlabSize);
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * @brief Destroys the node pool and releases all slabs.
+     *
+     */
+    ~NodePool()
+    {
+        release();
+    }
+
+    /**
+     * @brief Allocates storage for a single node.
+     *
+     * Runtime: \f$ O(1) \f$ amortized
+     *
+     * @return A pointer to uninitialized storage for one node
+     */
+    T* allocate()
+    {
+        if (!freeList)
+        {
+            _grow();
+        }
+
+        Block* block = freeList;
+        freeList = block->next;
+
+        return reinterpret_cast<T*>(&block->storage);
+    }
+
+    /**
+     * @brief Allocates storage for many nodes within one contiguous slab.
+     *
+     * The slab is sized exactly to `n` nodes, whose addresses are appended to 
+     * `nodes` in ascending order. The nodes may be deallocated separately.
+     *
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param n Number of nodes to allocate
+     * @param nodes Vector the pointers to uninitialized storage are appended to
+     */
+    void allocateBulk(std::size_t n, std::vector<T*>& nodes);
+
+    /**
+     * @brief Ensures that the slabs of this pool can hold `n` nodes.
+     *
+     * Missing capacity is added as one slab sized exactly to the difference,
+     * whose nodes are threaded onto the free list. Afterwards, allocations do
+     * not request memory from the system until more than `n` nodes are in
+     * use.
+     *
+     * Runtime: \f$ O(n) \f$
+     *
+     * @param n Number of nodes the pool must be able to hold
+     */
+    void reserve(std::size_t n)
+    {
+        if (n > capacity)
+        {
+            _addSlab(n - capacity);
+        }
+    }
+
+    /**
+     * @brief Returns the storage of a single node to the free list.
+     *
+     * The node must already be destroyed. Its storage may stem from any pool
+     * that is spliced into or retained by this pool.
+     *
+     * Runtime: \f$ O(1) \f$
+     *
+     * @param node Pointer to the storage to release
+     */
+    void deallocate(T* node)
+    {
+        Block* block = reinterpret_cast<Block*>(node);
+        block->next = freeList;
+        freeList = block;
+    }
+
+    /**
+     * @brief Returns all slabs to the system at once.
+     *
+     * Every pointer handed out by the pool becomes invalid. Nodes still in use
+     * are not destroyed.
+     *
+     * Runtime: \f$ O(s) \f$ for \f$ s \f$ slabs
+     */
+    void release();
+
+    /**
+     * @brief Moves all slabs and free nodes of another pool into this pool.
+     *
+     * Afterwards, this pool owns every node allocated from `other`, which
+     * becomes an empty pool starting over with slabs of the initial size.
+     * The free nodes of `other` are reused before this pool adds slabs.
+     *
+     * Runtime: \f$ O(s) \f$ for \f$ s \f$ slabs of `other`
+     *
+     * @param other The pool to take the slabs from
+     */
+    void splice(NodePool<T>& other);
+
+    /**
+     * @brief Keeps another pool alive for at least as long as this pool.
+     *
+     * Used whenever nodes of a pool that is still shared with other heaps
+     * move into a heap using this pool.
+     *
+     * @param other The pool to retain
+     */
+    void retain(const std::shared_ptr<NodePool<T>>& other)
+    {
+        if (other.get() == this)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < retained.size(); ++i)
+        {
+            if (retained[i] == other)
+            {
+                return;
+            }
+        }
+
+        retained.push_back(other);
+    }
+
+    /**
+     * @brief Determines the number of nodes the slabs of this pool can hold.
+     *
+     * @return The total number of nodes in all slabs
+     */
+    std::size_t getCapacity() const
+    {
+        return capacity;
+    }
+
+private:
+    void _grow();
+
+    void _addSlab(std::size_t n);
+};
+
+#include "NodePool.hpp"
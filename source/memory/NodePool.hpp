@@ -0,0 +1,102 @@
+template<class T>
+void NodePool<T>::allocateBulk(std::size_t n, std::vector<T*>& nodes)
+{
+    if (n == 0)
+    {
+        return;
+    }
+
+    Block* slab = new Block[n];
+    slabs.push_back(slab);
+    capacity += n;
+
+    nodes.reserve(nodes.size() + n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        nodes.push_back(reinterpret_cast<T*>(&slab[i].storage));
+    }
+}
+
+template<class T>
+void NodePool<T>::release()
+{
+    for (std::size_t i = 0; i < slabs.size(); ++i)
+    {
+        delete[] slabs[i];
+    }
+
+    slabs.clear();
+    freeList = NULL;
+    spareLists.clear();
+    capacity = 0;
+
+    retained.clear();
+}
+
+template<class T>
+void NodePool<T>::splice(NodePool<T>& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+
+    slabs.insert(slabs.end(), other.slabs.begin(), other.slabs.end());
+    capacity += other.capacity;
+
+    // keep free lists apart instead of walking them to concatenate
+    if (other.freeList)
+    {
+        spareLists.push_back(other.freeList);
+    }
+    spareLists.insert(spareLists.end(), other.spareLists.begin(),
+        other.spareLists.end());
+
+    for (std::size_t i = 0; i < other.retained.size(); ++i)
+    {
+        retain(other.retained[i]);
+    }
+
+    other.slabs.clear();
+    other.freeList = NULL;
+    other.spareLists.clear();
+    other.slabSize = other.initialSlabSize;
+    other.capacity = 0;
+    other.retained.clear();
+}
+
+template<class T>
+void NodePool<T>::_grow()
+{
+    if (!spareLists.empty())
+    {
+        freeList = spareLists.back();
+        spareLists.pop_back();
+
+        return;
+    }
+
+    _addSlab(slabSize);
+
+    if (2 * slabSize <= maxSlabSize)
+    {
+        slabSize *= 2;
+    }
+}
+
+template<class T>
+void NodePool<T>::_addSlab(std::size_t n)
+{
+    Block* slab = new Block[n];
+
+    // thread new nodes onto the free list
+    for (std::size_t i = 0; i + 1 < n; ++i)
+    {
+        slab[i].next = &slab[i + 1];
+    }
+    slab[n - 1].next = freeList;
+    freeList = slab;
+
+    slabs.push_back(slab);
+    capacity += n;
+}
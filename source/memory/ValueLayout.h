@@ -0,0 +1,173 @@
+#pragma once
+
+#include "NodePool.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Node layout which stores values within the heap nodes.
+ *
+ * Links, key and value of an element share one node, hence deleting the
+ * minimum reads its value without another memory access. This is the default
+ * layout and suits small value types.
+ */
+struct InlineValues
+{
+    template<class V> class Store;
+
+    /**
+     * @brief Template for the value member of a heap node.
+     *
+     * @tparam V Template parameter for value types
+     */
+    template<class V>
+    class Slot
+    {
+    public:
+        template<class... Args>
+        explicit Slot(Store<V>&, Args&&... args)
+        : value(std::forward<Args>(args)...)
+        {
+        }
+
+        V& get()
+        {
+            return value;
+        }
+
+    private:
+        V value;
+    };
+
+    /**
+     * @brief Template for the value storage of a heap, which is empty.
+     *
+     * @tparam V Template parameter for value types
+     */
+    template<class V>
+    class Store
+    {
+    public:
+        void destroy(Slot<V>&)
+        {
+        }
+
+        void reserve(std::size_t)
+        {
+        }
+
+        bool releasable()
+        {
+            return true;
+        }
+
+        void release()
+        {
+        }
+
+        void merge(Store<V>&)
+        {
+        }
+    };
+};
+
+/**
+ * @brief Node layout which stores values outside of the heap nodes.
+ *
+ * Heap nodes only hold links, key and a pointer to their value, which lives
+ * in a separate node pool of the heap. Nodes and values are allocated and
+ * released together, such that both pools grow alike and the slabs of nodes
+ * stay compact: linking trees and pairing passes, which only touch keys and
+ * links, fit many more nodes into each cache line for large value types.
+ *
+ * Accessing the value of the minimum costs one additional memory access.
+ */
+struct SplitValues
+{
+    template<class V> class Store;
+
+    /**
+     * @brief Template for the value member of a heap node, pointing to a
+     * value within the store of the heap.
+     *
+     * @tparam V Template parameter for value types
+     */
+    template<class V>
+    class Slot
+    {
+    public:
+        friend class Store<V>;
+
+        template<class... Args>
+        explicit Slot(Store<V>& store, Args&&... args)
+        : value(store.create(std::forward<Args>(args)...))
+        {
+        }
+
+        V& get()
+        {
+            return *value;
+        }
+
+    private:
+        V* value;
+    };
+
+    /**
+     * @brief Template for the value storage of a heap, owning a node pool of
+     * values.
+     *
+     * Stores are never shared between heaps. Merging heaps moves the values
+     * of the other heap into this store.
+     *
+     * @tparam V Template parameter for value types
+     */
+    template<class V>
+    class Store
+    {
+    private:
+        NodePool<V> pool;
+
+    public:
+        template<class... Args>
+        V* create(Args&&... args)
+        {
+            return new (pool.allocate()) V(std::forward<Args>(args)...);
+        }
+
+        void destroy(Slot<V>& slot)
+        {
+            slot.value->~V();
+            pool.deallocate(slot.value);
+        }
+
+        void reserve(std::size_t n)
+        {
+            pool.reserve(n);
+        }
+
+        /**
+         * @brief Checks whether all values may be released at once, without
+         * destroying them separately.
+         *
+         * @return true if values are trivially destructible, false otherwise
+         */
+        bool releasable()
+        {
+            return std::is_trivially_destructible<V>::value;
+        }
+
+        void release()
+        {
+            pool.release();
+        }
+
+        void merge(Store<V>& other)
+        {
+            pool.splice(other.pool);
+        }
+    };
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+/**
+ * @brief Determines the index of the least significant set bit.
+ *
+ * Runtime: \f$ O(1) \f$ with compiler intrinsics, \f$ O(w) \f$ otherwise
+ *
+ * @param word A word with at least one set bit
+ * @return The index of the lowest set bit
+ */
+inline int lowestBit(std::uint64_t word)
+{
+    assert(word);
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        ++index;
+    }
+
+    return index;
+#endif
+}
+
+/**
+ * @brief Determines the index of the most significant set bit.
+ *
+ * Runtime: \f$ O(1) \f$ with compiler intrinsics, \f$ O(w) \f$ otherwise
+ *
+ * @param word A word with at least one set bit
+ * @return The index of the highest set bit
+ */
+inline int highestBit(std::uint64_t word)
+{
+    assert(word);
+
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(word);
+#else
+    int index = 0;
+    while (word >>= 1)
+    {
+        ++index;
+    }
+
+    return index;
+#endif
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Instrumentation policy which does not count anything.
+ *
+ * Every method is an empty inline function, hence heaps instantiated with
+ * this policy compile to the same code as without instrumentation.
+ */
+struct NoStats
+{
+    static const bool enabled = false;
+
+    void comparison()
+    {
+    }
+
+    void link()
+    {
+    }
+
+    void cut()
+    {
+    }
+
+    void cascadingCut()
+    {
+    }
+
+    void consolidation(std::uint64_t)
+    {
+    }
+
+    void rank(int)
+    {
+    }
+
+    void reset()
+    {
+    }
+};
+
+/**
+ * @brief Instrumentation policy which counts the work done by a heap.
+ *
+ * Heaps report key comparisons, links of two trees, cuts of subtrees and
+ * cascading cuts of marked parents. Every consolidation of the root list,
+ * i.e. every pass combining the trees of the forest, reports the number of
+ * trees it combined. Heaps maintaining ranks report the rank of every
+ * linked root.
+ */
+struct CountingStats
+{
+    static const bool enabled = true;
+
+    std::uint64_t comparisons;
+    std::uint64_t links;
+    std::uint64_t cuts;
+    std::uint64_t cascadingCuts;
+
+    std::uint64_t consolidations;
+    std::uint64_t roots;
+    std::uint64_t maxRoots;
+
+    int maxRank;
+
+    CountingStats()
+    {
+        reset();
+    }
+
+    void comparison()
+    {
+        ++comparisons;
+    }
+
+    void link()
+    {
+        ++links;
+    }
+
+    void cut()
+    {
+        ++cuts;
+    }
+
+    void cascadingCut()
+    {
+        ++cascadingCuts;
+    }
+
+    void consolidation(std::uint64_t trees)
+    {
+        ++consolidations;
+        roots += trees;
+
+        if (trees > maxRoots)
+        {
+            maxRoots = trees;
+        }
+    }
+
+    void rank(int value)
+    {
+        if (value > maxRank)
+        {
+            maxRank = value;
+        }
+    }
+
+    /**
+     * @brief Resets all counters to zero.
+     *
+     */
+    void reset()
+    {
+        comparisons = 0;
+        links = 0;
+        cuts = 0;
+        cascadingCuts = 0;
+
+        consolidations = 0;
+        roots = 0;
+        maxRoots = 0;
+
+        maxRank = 0;
+    }
+};
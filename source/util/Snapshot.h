@@ -0,0 +1,305 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Header of a heap snapshot file.
+ *
+ * A snapshot consists of this header, padded to `Snapshot::OFFSET` bytes,
+ * followed by one `SnapshotNode` per heap node. Nodes refer to each other by
+ * their 32 bit index within the file instead of by pointer, hence the file
+ * contains no addresses and may be mapped at any address.
+ *
+ * The byte order marker and the sizes of nodes, values and keys reject
+ * snapshots written on an incompatible platform or for other types.
+ */
+struct SnapshotHeader
+{
+    char magic[8];
+    std::uint32_t byteOrder;
+    std::uint32_t version;
+    std::uint32_t kind;
+    std::uint32_t nodeSize;
+    std::uint32_t valueSize;
+    std::uint32_t keySize;
+    std::uint64_t count;
+    std::uint32_t forest;
+    std::uint32_t minPtr;
+};
+
+/**
+ * @brief Template for nodes of a heap snapshot file.
+ *
+ * Links are indices of nodes within the file, `Snapshot::NIL` if absent.
+ * Siblings are stored consecutively in the order of their circular list,
+ * starting with the sibling the `child` index of their parent refers to.
+ * Rank and mark are only used by fibonacci heaps.
+ *
+ * @tparam V Template parameter for trivially copyable value types
+ * @tparam K Template parameter for trivially copyable key types
+ */
+template<class V, class K>
+struct SnapshotNode
+{
+    std::uint32_t parent;
+    std::uint32_t left;
+    std::uint32_t right;
+    std::uint32_t child;
+    std::uint32_t rank;
+    std::uint32_t marked;
+
+    V value;
+    K key;
+};
+
+/**
+ * @brief Constants and helpers of the heap snapshot format.
+ */
+struct Snapshot
+{
+    static const std::uint32_t NIL = 0xFFFFFFFF;
+
+    static const std::uint32_t VERSION = 1;
+
+    static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    // nodes start at a fixed offset, which keeps them aligned in a mapping
+    static const std::size_t OFFSET = 64;
+
+    static_assert(sizeof(SnapshotHeader) <= OFFSET,
+        "snapshot header must fit in front of the nodes");
+
+    enum Kind
+    {
+        FIBONACCI = 1,
+        PAIRING = 2
+    };
+
+    /**
+     * @brief Writes a snapshot file.
+     *
+     * @param path Path of the file to write
+     * @param kind Kind of the heap the nodes stem from
+     * @param nodes Nodes of the heap in index order
+     * @param forest Index of the first root
+     * @param minPtr Index of the root with the smallest key
+     * @return true if the file was written completely, false otherwise
+     */
+    template<class V, class K>
+    static bool write(const char* path, Kind kind,
+        const std::vector<SnapshotNode<V, K>>& nodes, std::uint32_t forest,
+        std::uint32_t minPtr)
+    {
+        static_assert(std::is_trivially_copyable<V>::value
+            && std::is_trivially_copyable<K>::value,
+            "snapshots require trivially copyable values and keys");
+
+        char header[OFFSET];
+        std::memset(header, 0, sizeof(header));
+
+        SnapshotHeader* fields = reinterpret_cast<SnapshotHeader*>(header);
+        std::memcpy(fields->magic, "HEAPSNAP", sizeof(fields->magic));
+        fields->byteOrder = BYTE_ORDER_MARK;
+        fields->version = VERSION;
+        fields->kind = kind;
+        fields->nodeSize = sizeof(SnapshotNode<V, K>);
+        fields->valueSize = sizeof(V);
+        fields->keySize = sizeof(K);
+        fields->count = nodes.size();
+        fields->forest = forest;
+        fields->minPtr = minPtr;
+
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file)
+        {
+            return false;
+        }
+
+        bool written = std::fwrite(header, OFFSET, 1, file) == 1
+            && (nodes.empty() || std::fwrite(nodes.data(),
+                sizeof(SnapshotNode<V, K>), nodes.size(), file)
+                    == nodes.size());
+
+        return std::fclose(file) == 0 && written;
+    }
+};
+
+/**
+ * @brief Read-only view of a heap snapshot file.
+ *
+ * On POSIX systems, the file is mapped into memory, such that its nodes are
+ * used directly without reading the file up front: e.g. the smallest element
+ * is available as soon as the view is opened. Elsewhere, the file is read
+ * into a buffer.
+ */
+class SnapshotFile
+{
+private:
+    const char* data;
+    std::size_t length;
+
+    // fallback buffer if the file cannot be mapped
+    std::vector<std::uint64_t> buffer;
+
+public:
+    /**
+     * @brief Opens a snapshot file.
+     *
+     * @param path Path of the file to open
+     */
+    explicit SnapshotFile(const char* path)
+    : data(NULL), length(0)
+    {
+#if defined(__unix__)
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat status;
+        if (fstat(fd, &status) == 0 && status.st_size > 0)
+        {
+            void* mapping = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE,
+                fd, 0);
+            if (mapping != MAP_FAILED)
+            {
+                data = static_cast<const char*>(mapping);
+                length = status.st_size;
+            }
+        }
+
+        close(fd);
+#else
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file)
+        {
+            return;
+        }
+
+        if (std::fseek(file, 0, SEEK_END) == 0)
+        {
+            long size = std::ftell(file);
+            if (size > 0 && std::fseek(file, 0, SEEK_SET) == 0)
+            {
+                buffer.resize((size + 7) / 8);
+                if (std::fread(buffer.data(), size, 1, file) == 1)
+                {
+                    data = reinterpret_cast<const char*>(buffer.data());
+                    length = size;
+                }
+            }
+        }
+
+        std::fclose(file);
+#endif
+    }
+
+    SnapshotFile(const SnapshotFile&) = delete;
+    SnapshotFile& operator=(const SnapshotFile&) = delete;
+
+    /**
+     * @brief Closes the snapshot file.
+     *
+     */
+    ~SnapshotFile()
+    {
+#if defined(__unix__)
+        if (data)
+        {
+            munmap(const_cast<char*>(data), length);
+        }
+#endif
+    }
+
+    /**
+     * @brief Gets the header of the snapshot.
+     *
+     * @return A pointer to the header, or `NULL` if the file could not be
+     * opened or is too short
+     */
+    const SnapshotHeader* header() const
+    {
+        if (length < Snapshot::OFFSET)
+        {
+            return NULL;
+        }
+
+        return reinterpret_cast<const SnapshotHeader*>(data);
+    }
+
+    /**
+     * @brief Gets the nodes of a snapshot of a given kind.
+     *
+     * The snapshot must match the platform, the kind and the types `V` and
+     * `K`, its number of nodes must fit the `int` size of the heaps, and
+     * every index must refer to a node within the file.
+     *
+     * Runtime: \f$ O(n) \f$ to check all indices
+     *
+     * @param kind Kind of the heap the snapshot is expected to stem from
+     * @return A pointer to the first node, or `NULL` if the snapshot does not
+     * match or is corrupt
+     */
+    template<class V, class K>
+    const SnapshotNode<V, K>* nodes(Snapshot::Kind kind) const
+    {
+        const SnapshotHeader* fields = header();
+        if (!fields
+            || std::memcmp(fields->magic, "HEAPSNAP", sizeof(fields->magic))
+            || fields->byteOrder != Snapshot::BYTE_ORDER_MARK
+            || fields->version != Snapshot::VERSION
+            || fields->kind != static_cast<std::uint32_t>(kind)
+            || fields->nodeSize != sizeof(SnapshotNode<V, K>)
+            || fields->valueSize != sizeof(V)
+            || fields->keySize != sizeof(K)
+            || fields->count >= Snapshot::NIL
+            || fields->count > static_cast<std::uint64_t>(
+                std::numeric_limits<int>::max())
+            || (length - Snapshot::OFFSET) / sizeof(SnapshotNode<V, K>)
+                < fields->count)
+        {
+            return NULL;
+        }
+
+        std::uint32_t count = static_cast<std::uint32_t>(fields->count);
+        const SnapshotNode<V, K>* nodes =
+            reinterpret_cast<const SnapshotNode<V, K>*>(
+                data + Snapshot::OFFSET);
+
+        bool empty = count == 0;
+        if (empty != (fields->forest == Snapshot::NIL)
+            || empty != (fields->minPtr == Snapshot::NIL)
+            || (!empty && (fields->forest >= count
+                || fields->minPtr >= count)))
+        {
+            return NULL;
+        }
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const SnapshotNode<V, K>& node = nodes[i];
+            if ((node.parent != Snapshot::NIL && node.parent >= count)
+                || node.left >= count || node.right >= count
+                || (node.child != Snapshot::NIL && node.child >= count))
+            {
+                return NULL;
+            }
+        }
+
+        return nodes;
+    }
+};